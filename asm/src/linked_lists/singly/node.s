@@ -1,39 +1,46 @@
 .intel_syntax noprefix
 .text
 
-; System V AMD64 ABI
-; rdi, rsi, rdx, rcx, r8, r9
-; return in rax
+# System V AMD64 ABI
+# rdi, rsi, rdx, rcx, r8, r9
+# return in rax
 
-; struct Node
-; 0  : void* value_
-; 8  : Node* next_
+# struct Node
+# 0  : void* value_
+# 8  : Node* next_
 
-; struct SinglyLinkedList
-; 0  : Node* sentinel_
-; 8  : Node* tail_
-; 16 : size_t size_
+# struct SinglyLinkedList
+# 0  : Node* sentinel_
+# 8  : Node* tail_
+# 16 : size_t size_
 
+.globl node_new
+.type node_new, @function
 node_new:
-    push rbp
-    mov rbp, rsp
-
-    ; rdi = value_
-    ; rsi = next_
-
-    ; malloc(sizeof(Node)) = 16
-    mov rdi, 16
-    call malloc
+    # rdi = value_
+    # rsi = next_
+    # both are caller-saved, so keep them in callee-saved registers
+    push rbx
+    push r12
+    sub rsp, 8              # realign the stack to 16 bytes for the call
+    mov rbx, rdi
+    mov r12, rsi
+
+    # malloc(sizeof(Node)) = 16
+    mov edi, 16
+    call malloc@PLT
 
     test rax, rax
-    je .fail
+    je .Lfail
 
-    mov [rax], rdi	; value_
-    mov [rax + 1], rsi	; next_
+    mov [rax], rbx          # value_
+    mov [rax + 8], r12      # next_
 
-    leave
+.Lfail:
+    add rsp, 8
+    pop r12
+    pop rbx
     ret
+.size node_new, .-node_new
 
-.fail
-    xor rax, rax
-    leave ret
+.section .note.GNU-stack, "", @progbits
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "workload.hpp"
+
+// Runs every workload phase against one list implementation and prints one
+// tab-separated line per phase: operation, ops, seconds, checksum. The
+// checksum lets list_compare catch a backend that returns wrong results.
+//
+// Adapter provides create, destroy, push_back, at, contains, sort and
+// pop_front over its own List handle.
+template <typename Adapter>
+int run_backend(int argc, char** argv) {
+    std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100'000;
+    std::size_t queries = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 200;
+    workload::Workload w = workload::make(size, queries);
+
+    auto phase = [](const char* name, std::size_t ops, auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        std::uint64_t checksum = fn();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::printf("%s\t%zu\t%.9f\t%llu\n", name, ops, elapsed.count(), static_cast<unsigned long long>(checksum));
+    };
+
+    auto list = Adapter::create();
+
+    phase("ingest", w.values.size(), [&] {
+        for (std::uint64_t v : w.values) Adapter::push_back(list, v);
+        return std::uint64_t(w.values.size());
+    });
+
+    phase("random at", w.positions.size(), [&] {
+        std::uint64_t sum = 0;
+        for (std::size_t pos : w.positions) sum += Adapter::at(list, pos);
+        return sum;
+    });
+
+    phase("search hit", w.hits.size(), [&] {
+        std::uint64_t found = 0;
+        for (std::uint64_t v : w.hits) found += Adapter::contains(list, v);
+        return found;
+    });
+
+    phase("search miss", w.misses.size(), [&] {
+        std::uint64_t found = 0;
+        for (std::uint64_t v : w.misses) found += Adapter::contains(list, v);
+        return found;
+    });
+
+    phase("sort", w.values.size(), [&] {
+        Adapter::sort(list);
+        return Adapter::at(list, 0) ^ Adapter::at(list, w.values.size() / 2);
+    });
+
+    phase("drain", w.values.size(), [&] {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < w.values.size(); i++) sum = sum * 31 + Adapter::pop_front(list);
+        return sum;
+    });
+
+    Adapter::destroy(list);
+    return 0;
+}
@@ -0,0 +1,34 @@
+#include <cstdint>
+
+#include "backend.hpp"
+
+// Built twice: against the C list and against the asm list, which share
+// this header-level API and its symbol names.
+extern "C" {
+#include "linked_lists/singly.h"
+}
+
+struct CApiAdapter {
+    using List = SinglyLinkedList*;
+
+    static void* box(std::uint64_t value) { return reinterpret_cast<void*>(static_cast<std::uintptr_t>(value)); }
+    static std::uint64_t unbox(void* value) { return reinterpret_cast<std::uintptr_t>(value); }
+
+    static List create() { return singly_list_new(); }
+
+    static void destroy(List list) {
+        clear(list);
+        std::free(list->sentinel_);
+        std::free(list);
+    }
+
+    static void push_back(List list, std::uint64_t value) { ::push_back(list, box(value)); }
+    static std::uint64_t at(List list, std::size_t pos) { return unbox(::at(list, pos)); }
+    static bool contains(List list, std::uint64_t value) { return search(list, box(value)) != nullptr; }
+    static void sort(List list) { ::sort(list); }
+    static std::uint64_t pop_front(List list) { return unbox(::pop_front(list)); }
+};
+
+int main(int argc, char** argv) {
+    return run_backend<CApiAdapter>(argc, argv);
+}
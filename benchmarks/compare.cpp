@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Runs every backend executable on the same workload and prints ns/op per
+// operation side by side, with the fastest backend starred. A checksum that
+// differs between backends means one of them returned a wrong result.
+//
+// Usage: list_compare [size] [queries] [json path]
+
+struct Sample {
+    std::size_t ops = 0;
+    double seconds = 0.0;
+    unsigned long long checksum = 0;
+};
+
+struct Backend {
+    std::string name;
+    std::string path;
+    std::map<std::string, Sample> samples;
+};
+
+static std::vector<Backend> configuredBackends() {
+    std::vector<Backend> backends;
+    std::stringstream spec(LIST_COMPARE_BACKENDS);
+    std::string entry;
+    while (std::getline(spec, entry, '|')) {
+        std::size_t eq = entry.find('=');
+        backends.push_back({entry.substr(0, eq), entry.substr(eq + 1), {}});
+    }
+    return backends;
+}
+
+static bool runBackend(Backend& backend, const std::string& args, std::vector<std::string>& order) {
+    std::string command = "\"" + backend.path + "\" " + args;
+    FILE* pipe = popen(command.c_str(), "r");
+    if (!pipe) return false;
+
+    char line[256];
+    while (std::fgets(line, sizeof(line), pipe)) {
+        std::stringstream fields(line);
+        std::string op;
+        Sample sample;
+        if (!std::getline(fields, op, '\t')) continue;
+        if (!(fields >> sample.ops >> sample.seconds >> sample.checksum)) continue;
+
+        if (!backend.samples.count(op) && std::find(order.begin(), order.end(), op) == order.end()) order.push_back(op);
+        backend.samples[op] = sample;
+    }
+    return pclose(pipe) == 0;
+}
+
+int main(int argc, char** argv) {
+    std::string size = argc > 1 ? argv[1] : "100000";
+    std::string queries = argc > 2 ? argv[2] : "200";
+    std::string jsonPath = argc > 3 ? argv[3] : "list_compare.json";
+
+    std::vector<Backend> backends = configuredBackends();
+    std::vector<std::string> order;
+    for (Backend& backend : backends) {
+        if (!runBackend(backend, size + " " + queries, order)) {
+            std::fprintf(stderr, "backend %s failed\n", backend.name.c_str());
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::printf("%-14s", "ns/op");
+    for (const Backend& backend : backends) std::printf("%14s", backend.name.c_str());
+    std::printf("\n");
+
+    bool mismatch = false;
+    for (const std::string& op : order) {
+        const Backend* fastest = nullptr;
+        for (const Backend& backend : backends) {
+            auto it = backend.samples.find(op);
+            if (it == backend.samples.end()) continue;
+            if (!fastest || it->second.seconds < fastest->samples.at(op).seconds) fastest = &backend;
+        }
+
+        std::printf("%-14s", op.c_str());
+        for (const Backend& backend : backends) {
+            auto it = backend.samples.find(op);
+            if (it == backend.samples.end()) {
+                std::printf("%14s", "-");
+                continue;
+            }
+            double ns = it->second.ops ? it->second.seconds * 1e9 / it->second.ops : 0.0;
+            std::printf("%13.1f%c", ns, &backend == fastest ? '*' : ' ');
+
+            if (it->second.checksum != fastest->samples.at(op).checksum) mismatch = true;
+        }
+        std::printf("\n");
+    }
+
+    std::ofstream json(jsonPath);
+    json << "{\n  \"size\": " << size << ",\n  \"queries\": " << queries << ",\n  \"backends\": {";
+    for (std::size_t b = 0; b < backends.size(); b++) {
+        json << (b ? "," : "") << "\n    \"" << backends[b].name << "\": {";
+        std::size_t i = 0;
+        for (const std::string& op : order) {
+            auto it = backends[b].samples.find(op);
+            if (it == backends[b].samples.end()) continue;
+            json << (i++ ? "," : "") << "\n      \"" << op << "\": {\"ops\": " << it->second.ops
+                 << ", \"seconds\": " << it->second.seconds << ", \"checksum\": " << it->second.checksum << "}";
+        }
+        json << "\n    }";
+    }
+    json << "\n  }\n}\n";
+
+    if (mismatch) {
+        std::fprintf(stderr, "checksums differ between backends\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,21 @@
+#include <cstdint>
+
+#include "backend.hpp"
+#include "list.hpp"
+
+struct CppAdapter {
+    using List = SinglyLinkedList<std::uint64_t>*;
+
+    static List create() { return new SinglyLinkedList<std::uint64_t>(); }
+    static void destroy(List list) { delete list; }
+
+    static void push_back(List list, std::uint64_t value) { list->push_back(value); }
+    static std::uint64_t at(List list, std::size_t pos) { return list->at(pos); }
+    static bool contains(List list, std::uint64_t value) { return list->find(value) != nullptr; }
+    static void sort(List list) { list->sort(); }
+    static std::uint64_t pop_front(List list) { return list->pop_front(); }
+};
+
+int main(int argc, char** argv) {
+    return run_backend<CppAdapter>(argc, argv);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace workload {
+
+// splitmix64: the same seed gives the same workload on every backend
+class Generator {
+private:
+    std::uint64_t state_;
+public:
+    explicit Generator(std::uint64_t seed) noexcept : state_(seed) {}
+
+    std::uint64_t next() noexcept {
+        std::uint64_t z = (state_ += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    std::size_t below(std::size_t bound) noexcept {
+        return static_cast<std::size_t>(next() % bound);
+    }
+};
+
+// Stored values are even; misses are odd, so they can never be found.
+struct Workload {
+    std::vector<std::uint64_t> values;
+    std::vector<std::size_t> positions;
+    std::vector<std::uint64_t> hits;
+    std::vector<std::uint64_t> misses;
+};
+
+inline Workload make(std::size_t size, std::size_t queries, std::uint64_t seed = 42) {
+    Generator rng(seed);
+    Workload w;
+
+    w.values.resize(size);
+    for (auto& v : w.values) v = (rng.next() >> 2) << 1;
+
+    if (size == 0) return w;
+    w.positions.resize(queries);
+    w.hits.resize(queries);
+    w.misses.resize(queries);
+    for (std::size_t i = 0; i < queries; i++) {
+        w.positions[i] = rng.below(size);
+        w.hits[i] = w.values[rng.below(size)];
+        w.misses[i] = w.values[rng.below(size)] | 1;
+    }
+    return w;
+}
+
+}
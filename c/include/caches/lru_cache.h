@@ -0,0 +1,75 @@
+#ifndef LRU_CACHE_H
+#define LRU_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <threads.h>
+
+struct Node;
+struct DoublyLinkedList;
+
+// Called with every value that leaves the cache through eviction, through
+// replacement by lru_cache_put, or through lru_cache_clear.
+typedef void (*lru_evict_fn)(uint64_t key, void* value, void* user_data);
+
+typedef struct LruEntry {
+    uint64_t key_;
+    void* value_;
+} LruEntry;
+
+typedef struct LruSlot {
+    uint64_t key_;
+    struct Node* node_;
+} LruSlot;
+
+// Open-addressing table (linear probing, backward-shift deletion) from key
+// to list node; the list keeps entries in recency order, most recent first.
+typedef struct LruCache {
+    struct DoublyLinkedList* order_;
+    LruSlot* slots_;
+    size_t slot_mask_;
+    LruEntry* entries_;
+    size_t* free_entries_;
+    size_t free_count_;
+    size_t capacity_;
+    lru_evict_fn on_evict_;
+    void* user_data_;
+} LruCache;
+
+LruCache* lru_cache_new(size_t capacity, lru_evict_fn on_evict, void* user_data);
+void lru_cache_free(LruCache* cache);
+
+size_t lru_cache_size(const LruCache* cache);
+size_t lru_cache_capacity(const LruCache* cache);
+
+bool lru_cache_get(LruCache* cache, uint64_t key, void** value);
+bool lru_cache_contains(const LruCache* cache, uint64_t key);
+bool lru_cache_put(LruCache* cache, uint64_t key, void* value);
+bool lru_cache_remove(LruCache* cache, uint64_t key, void** value);
+bool lru_cache_evict(LruCache* cache);
+void lru_cache_clear(LruCache* cache);
+
+
+typedef struct LruShard {
+    mtx_t lock_;
+    LruCache* cache_;
+} LruShard;
+
+// Keys are spread over independently locked shards, each holding an equal
+// share of the capacity. Eviction callbacks run under the shard's lock.
+typedef struct ShardedLruCache {
+    LruShard* shards_;
+    size_t shard_mask_;
+} ShardedLruCache;
+
+ShardedLruCache* sharded_lru_cache_new(size_t capacity, size_t shards, lru_evict_fn on_evict, void* user_data);
+void sharded_lru_cache_free(ShardedLruCache* cache);
+
+size_t sharded_lru_cache_size(ShardedLruCache* cache);
+
+bool sharded_lru_cache_get(ShardedLruCache* cache, uint64_t key, void** value);
+bool sharded_lru_cache_put(ShardedLruCache* cache, uint64_t key, void* value);
+bool sharded_lru_cache_remove(ShardedLruCache* cache, uint64_t key, void** value);
+
+#endif
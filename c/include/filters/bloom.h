@@ -0,0 +1,58 @@
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Maps a stored value to a 64-bit hash; NULL hashes the pointer bits.
+typedef uint64_t (*bloom_hash_fn)(const void* value, void* user_data);
+
+#define BLOOM_BLOCK_WORDS 8
+
+// One cache line: every probe for a key touches a single block.
+typedef struct BloomBlock {
+    alignas(64) uint64_t words_[BLOOM_BLOCK_WORDS];
+} BloomBlock;
+
+// Blocked Bloom filter. Keys are only ever added; callers rebuild it from
+// scratch once enough of them are gone.
+typedef struct BloomFilter {
+    BloomBlock* blocks_;
+    size_t block_mask_;
+    unsigned hashes_;
+    size_t bits_per_item_;
+    size_t capacity_;
+    size_t items_;
+    bloom_hash_fn hash_;
+    void* user_data_;
+} BloomFilter;
+
+BloomFilter* bloom_new(size_t capacity, size_t bits_per_item, bloom_hash_fn hash, void* user_data);
+void bloom_free(BloomFilter* filter);
+
+// Empties the filter and resizes it for `capacity` items
+bool bloom_reset(BloomFilter* filter, size_t capacity);
+
+void bloom_add(BloomFilter* filter, const void* value);
+bool bloom_may_contain(const BloomFilter* filter, const void* value);
+
+size_t bloom_items(const BloomFilter* filter);
+size_t bloom_capacity(const BloomFilter* filter);
+
+// False-positive rate predicted from how full each block is
+double bloom_estimated_fpr(const BloomFilter* filter);
+
+// What a list with a filter attached counts on search()
+typedef struct BloomStats {
+    uint64_t searches_;
+    uint64_t filtered_;
+    uint64_t false_positives_;
+    size_t erased_since_rebuild_;
+} BloomStats;
+
+// Share of searches for absent values that the filter failed to reject
+double bloom_observed_fpr(const BloomStats* stats);
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef LIST_FILTER_H
+#define LIST_FILTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "filters/bloom.h"
+
+// Optional Bloom filter a list keeps in front of search(), with the counters
+// it reports. bloom_ is NULL while the filter is off.
+typedef struct ListFilter {
+    BloomFilter* bloom_;
+    BloomStats stats_;
+} ListFilter;
+
+// Passes every value held by `list` to bloom_add
+typedef void (*list_filter_fill_fn)(const void* list, BloomFilter* bloom);
+
+void list_filter_init(ListFilter* filter);
+
+// Replaces any current filter with one sized for `items` and filled from
+// `list`. On failure the filter is left off and false is returned.
+bool list_filter_enable(ListFilter* filter, size_t items, size_t bits_per_item, bloom_hash_fn hash, void* user_data,
+                        list_filter_fill_fn fill, const void* list);
+void list_filter_disable(ListFilter* filter);
+
+// Refills the filter from `list`; turns it off and returns false if the
+// resized filter cannot be allocated.
+bool list_filter_rebuild(ListFilter* filter, size_t items, list_filter_fill_fn fill, const void* list);
+
+// Bookkeeping for a value that was just stored or removed. A full filter is
+// rebuilt at twice the list's size.
+void list_filter_added(ListFilter* filter, const void* value, size_t items, list_filter_fill_fn fill, const void* list);
+void list_filter_erased(ListFilter* filter);
+
+// search() hooks: rejects() is true when the value is certainly absent;
+// missed() records a scan the filter let through that found nothing.
+bool list_filter_rejects(ListFilter* filter, const void* value);
+void list_filter_missed(ListFilter* filter);
+
+#endif
@@ -4,6 +4,8 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
+#include "filters/list_filter.h"
+
 typedef struct Node {
     void* value_;
     struct Node* next_;
@@ -17,9 +19,20 @@ typedef struct DoublyLinkedList {
     Node* head_;
     Node* tail_;
     size_t size_;
+    ListFilter filter_;
 } DoublyLinkedList;
 
 DoublyLinkedList* doubly_list_new();
+void doubly_list_free(DoublyLinkedList* list);
+
+// Optional Bloom filter in front of search(): values are added on every
+// push and insert, and a negative answer returns NULL without a scan.
+// Removed values stay in the filter until it is rebuilt; it is rebuilt and
+// doubled in size by itself once it holds more items than it was sized for.
+bool doubly_list_enable_filter(DoublyLinkedList* list, size_t bits_per_item, bloom_hash_fn hash, void* user_data);
+void doubly_list_disable_filter(DoublyLinkedList* list);
+bool doubly_list_rebuild_filter(DoublyLinkedList* list);
+BloomStats doubly_list_filter_stats(const DoublyLinkedList* list);
 
 size_t size(DoublyLinkedList* list);
 bool is_empty(DoublyLinkedList* list);
@@ -30,10 +43,13 @@ void* at(DoublyLinkedList* list, size_t pos);
 
 Node* search(DoublyLinkedList* list, void* value);
 
-void push_front(DoublyLinkedList* list, void* value);
-void push_back(DoublyLinkedList* list, void* value);
+Node* push_front(DoublyLinkedList* list, void* value);
+Node* push_back(DoublyLinkedList* list, void* value);
 void insert(DoublyLinkedList* list, size_t pos, void* value);
 
+void move_to_front(DoublyLinkedList* list, Node* node);
+void* remove_node(DoublyLinkedList* list, Node* node);
+
 void* pop_front(DoublyLinkedList* list);
 void* pop_back(DoublyLinkedList* list);
 void* erase(DoublyLinkedList* list, size_t pos);
@@ -4,6 +4,8 @@
 #include <stdlib.h>
 #include <stdbool.h>
 
+#include "filters/list_filter.h"
+
 typedef struct Node {
     void* value_;
     struct Node* next_;
@@ -16,9 +18,20 @@ typedef struct SinglyLinkedList {
     Node* sentinel_;
     Node* tail_;
     size_t size_;
+    ListFilter filter_;
 } SinglyLinkedList;
 
 SinglyLinkedList* singly_list_new();
+void singly_list_free(SinglyLinkedList* list);
+
+// Optional Bloom filter in front of search(): values are added on every
+// push and insert, and a negative answer returns NULL without a scan.
+// Erased values stay in the filter until it is rebuilt; it is rebuilt and
+// doubled in size by itself once it holds more items than it was sized for.
+bool singly_list_enable_filter(SinglyLinkedList* list, size_t bits_per_item, bloom_hash_fn hash, void* user_data);
+void singly_list_disable_filter(SinglyLinkedList* list);
+bool singly_list_rebuild_filter(SinglyLinkedList* list);
+BloomStats singly_list_filter_stats(const SinglyLinkedList* list);
 
 size_t size(SinglyLinkedList* list);
 bool is_empty(SinglyLinkedList* list);
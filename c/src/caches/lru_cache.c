@@ -0,0 +1,249 @@
+#include "caches/lru_cache.h"
+#include "linked_lists/doubly.h"
+
+#include <stdlib.h>
+
+static uint64_t hash_key(uint64_t key) {
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return key;
+}
+
+static size_t slot_count_for(size_t capacity) {
+    // At most half full, so probe runs stay short
+    size_t count = 8;
+    while (count < capacity * 2) count <<= 1;
+    return count;
+}
+
+static size_t find_slot(const LruCache* cache, uint64_t key) {
+    size_t i = hash_key(key) & cache->slot_mask_;
+    while (cache->slots_[i].node_ && cache->slots_[i].key_ != key) i = (i + 1) & cache->slot_mask_;
+    return i;
+}
+
+static void clear_slot(LruCache* cache, size_t hole) {
+    // Backward-shift deletion: pull later members of the probe run into the
+    // hole so lookups never need tombstones.
+    size_t i = hole;
+    for (;;) {
+        i = (i + 1) & cache->slot_mask_;
+        if (!cache->slots_[i].node_) break;
+
+        size_t home = hash_key(cache->slots_[i].key_) & cache->slot_mask_;
+        if (((i - home) & cache->slot_mask_) >= ((i - hole) & cache->slot_mask_)) {
+            cache->slots_[hole] = cache->slots_[i];
+            hole = i;
+        }
+    }
+    cache->slots_[hole].node_ = NULL;
+}
+
+static LruEntry* entry_of(Node* node) {
+    return node->value_;
+}
+
+static void release_entry(LruCache* cache, Node* node) {
+    LruEntry* entry = remove_node(cache->order_, node);
+    cache->free_entries_[cache->free_count_++] = (size_t)(entry - cache->entries_);
+}
+
+LruCache* lru_cache_new(size_t capacity, lru_evict_fn on_evict, void* user_data) {
+    if (capacity == 0) return NULL;
+
+    LruCache* cache = malloc(sizeof(LruCache));
+    if (!cache) return NULL;
+
+    size_t slot_count = slot_count_for(capacity);
+    cache->order_ = doubly_list_new();
+    cache->slots_ = calloc(slot_count, sizeof(LruSlot));
+    cache->entries_ = malloc(capacity * sizeof(LruEntry));
+    cache->free_entries_ = malloc(capacity * sizeof(size_t));
+    if (!cache->order_ || !cache->slots_ || !cache->entries_ || !cache->free_entries_) {
+        if (cache->order_) doubly_list_free(cache->order_);
+        free(cache->slots_);
+        free(cache->entries_);
+        free(cache->free_entries_);
+        free(cache);
+        return NULL;
+    }
+
+    cache->slot_mask_ = slot_count - 1;
+    cache->capacity_ = capacity;
+    cache->free_count_ = capacity;
+    for (size_t i = 0; i < capacity; i++) cache->free_entries_[i] = capacity - 1 - i;
+    cache->on_evict_ = on_evict;
+    cache->user_data_ = user_data;
+
+    return cache;
+}
+
+void lru_cache_free(LruCache* cache) {
+    if (!cache) return;
+
+    lru_cache_clear(cache);
+    doubly_list_free(cache->order_);
+    free(cache->slots_);
+    free(cache->entries_);
+    free(cache->free_entries_);
+    free(cache);
+}
+
+size_t lru_cache_size(const LruCache* cache) {
+    return cache->order_->size_;
+}
+
+size_t lru_cache_capacity(const LruCache* cache) {
+    return cache->capacity_;
+}
+
+bool lru_cache_get(LruCache* cache, uint64_t key, void** value) {
+    Node* node = cache->slots_[find_slot(cache, key)].node_;
+    if (!node) return false;
+
+    move_to_front(cache->order_, node);
+    if (value) *value = entry_of(node)->value_;
+    return true;
+}
+
+bool lru_cache_contains(const LruCache* cache, uint64_t key) {
+    return cache->slots_[find_slot(cache, key)].node_ != NULL;
+}
+
+bool lru_cache_put(LruCache* cache, uint64_t key, void* value) {
+    size_t slot = find_slot(cache, key);
+    Node* node = cache->slots_[slot].node_;
+
+    if (node) {
+        LruEntry* entry = entry_of(node);
+        void* old_value = entry->value_;
+        entry->value_ = value;
+        move_to_front(cache->order_, node);
+        if (cache->on_evict_ && old_value != value) cache->on_evict_(key, old_value, cache->user_data_);
+        return false;
+    }
+
+    if (cache->free_count_ == 0) {
+        lru_cache_evict(cache);
+        // Eviction may have shifted the probe run this key belongs to
+        slot = find_slot(cache, key);
+    }
+
+    LruEntry* entry = &cache->entries_[cache->free_entries_[--cache->free_count_]];
+    entry->key_ = key;
+    entry->value_ = value;
+
+    cache->slots_[slot].key_ = key;
+    cache->slots_[slot].node_ = push_front(cache->order_, entry);
+    return true;
+}
+
+bool lru_cache_remove(LruCache* cache, uint64_t key, void** value) {
+    size_t slot = find_slot(cache, key);
+    Node* node = cache->slots_[slot].node_;
+    if (!node) return false;
+
+    if (value) *value = entry_of(node)->value_;
+    clear_slot(cache, slot);
+    release_entry(cache, node);
+    return true;
+}
+
+bool lru_cache_evict(LruCache* cache) {
+    if (is_empty(cache->order_)) return false;
+
+    Node* node = cache->order_->tail_->prev_;
+    LruEntry entry = *entry_of(node);
+
+    clear_slot(cache, find_slot(cache, entry.key_));
+    release_entry(cache, node);
+    if (cache->on_evict_) cache->on_evict_(entry.key_, entry.value_, cache->user_data_);
+    return true;
+}
+
+void lru_cache_clear(LruCache* cache) {
+    while (lru_cache_evict(cache)) {}
+}
+
+
+static LruShard* shard_for(ShardedLruCache* cache, uint64_t key) {
+    // High hash bits pick the shard; the table inside uses the low ones
+    return &cache->shards_[(hash_key(key) >> 48) & cache->shard_mask_];
+}
+
+ShardedLruCache* sharded_lru_cache_new(size_t capacity, size_t shards, lru_evict_fn on_evict, void* user_data) {
+    if (shards == 0 || (shards & (shards - 1)) != 0 || capacity < shards) return NULL;
+
+    ShardedLruCache* cache = malloc(sizeof(ShardedLruCache));
+    if (!cache) return NULL;
+    cache->shards_ = calloc(shards, sizeof(LruShard));
+    cache->shard_mask_ = shards - 1;
+    if (!cache->shards_) {
+        free(cache);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < shards; i++) {
+        cache->shards_[i].cache_ = lru_cache_new(capacity / shards, on_evict, user_data);
+        if (!cache->shards_[i].cache_ || mtx_init(&cache->shards_[i].lock_, mtx_plain) != thrd_success) {
+            lru_cache_free(cache->shards_[i].cache_);
+            for (size_t j = 0; j < i; j++) {
+                mtx_destroy(&cache->shards_[j].lock_);
+                lru_cache_free(cache->shards_[j].cache_);
+            }
+            free(cache->shards_);
+            free(cache);
+            return NULL;
+        }
+    }
+
+    return cache;
+}
+
+void sharded_lru_cache_free(ShardedLruCache* cache) {
+    if (!cache) return;
+
+    for (size_t i = 0; i <= cache->shard_mask_; i++) {
+        mtx_destroy(&cache->shards_[i].lock_);
+        lru_cache_free(cache->shards_[i].cache_);
+    }
+    free(cache->shards_);
+    free(cache);
+}
+
+size_t sharded_lru_cache_size(ShardedLruCache* cache) {
+    size_t total = 0;
+    for (size_t i = 0; i <= cache->shard_mask_; i++) {
+        mtx_lock(&cache->shards_[i].lock_);
+        total += lru_cache_size(cache->shards_[i].cache_);
+        mtx_unlock(&cache->shards_[i].lock_);
+    }
+    return total;
+}
+
+bool sharded_lru_cache_get(ShardedLruCache* cache, uint64_t key, void** value) {
+    LruShard* shard = shard_for(cache, key);
+    mtx_lock(&shard->lock_);
+    bool found = lru_cache_get(shard->cache_, key, value);
+    mtx_unlock(&shard->lock_);
+    return found;
+}
+
+bool sharded_lru_cache_put(ShardedLruCache* cache, uint64_t key, void* value) {
+    LruShard* shard = shard_for(cache, key);
+    mtx_lock(&shard->lock_);
+    bool inserted = lru_cache_put(shard->cache_, key, value);
+    mtx_unlock(&shard->lock_);
+    return inserted;
+}
+
+bool sharded_lru_cache_remove(ShardedLruCache* cache, uint64_t key, void** value) {
+    LruShard* shard = shard_for(cache, key);
+    mtx_lock(&shard->lock_);
+    bool removed = lru_cache_remove(shard->cache_, key, value);
+    mtx_unlock(&shard->lock_);
+    return removed;
+}
@@ -0,0 +1,143 @@
+#include "filters/bloom.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static uint64_t hash_pointer(const void* value, void* user_data) {
+    (void)user_data;
+    uint64_t key = (uint64_t)(uintptr_t)value;
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return key;
+}
+
+static size_t block_count_for(size_t capacity, size_t bits_per_item) {
+    size_t bits = (capacity ? capacity : 1) * bits_per_item;
+    size_t blocks = 1;
+    while (blocks * BLOOM_BLOCK_WORDS * 64 < bits) blocks <<= 1;
+    return blocks;
+}
+
+// The high half of the hash picks the block. Each probe inside it takes the
+// top nine bits of the low half times its own odd salt, as in split-block
+// Bloom filters; this spreads far better than double hashing modulo 512.
+static const uint32_t probe_salts[16] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+    0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U,
+    0x8ebdcb5fU, 0x2b6b3e1dU, 0xc1e8f1b9U, 0x6f0b2e35U,
+    0x3a8f05c5U, 0xd4c1a7e3U, 0x97d2b8f1U, 0x1b873593U,
+};
+
+static size_t block_index(const BloomFilter* filter, uint64_t hash) {
+    return (size_t)(hash >> 32) & filter->block_mask_;
+}
+
+static unsigned probe_bit(uint64_t hash, unsigned i) {
+    return ((uint32_t)hash * probe_salts[i]) >> (32 - 9);
+}
+
+static size_t count_ones(uint64_t word) {
+    size_t count = 0;
+    for (; word; word &= word - 1) count++;
+    return count;
+}
+
+BloomFilter* bloom_new(size_t capacity, size_t bits_per_item, bloom_hash_fn hash, void* user_data) {
+    if (bits_per_item == 0) return NULL;
+
+    BloomFilter* filter = malloc(sizeof(BloomFilter));
+    if (!filter) return NULL;
+
+    // k = bits_per_item * ln 2 minimises the false-positive rate
+    unsigned hashes = (unsigned)((double)bits_per_item * 0.693 + 0.5);
+    filter->hashes_ = hashes < 1 ? 1 : hashes > 16 ? 16 : hashes;
+    filter->bits_per_item_ = bits_per_item;
+    filter->hash_ = hash ? hash : hash_pointer;
+    filter->user_data_ = user_data;
+    filter->blocks_ = NULL;
+
+    if (!bloom_reset(filter, capacity)) {
+        free(filter);
+        return NULL;
+    }
+    return filter;
+}
+
+void bloom_free(BloomFilter* filter) {
+    if (!filter) return;
+    free(filter->blocks_);
+    free(filter);
+}
+
+bool bloom_reset(BloomFilter* filter, size_t capacity) {
+    size_t blocks = block_count_for(capacity, filter->bits_per_item_);
+    if (filter->blocks_ && filter->block_mask_ + 1 == blocks) {
+        memset(filter->blocks_, 0, blocks * sizeof(BloomBlock));
+    } else {
+        BloomBlock* storage = aligned_alloc(alignof(BloomBlock), blocks * sizeof(BloomBlock));
+        if (!storage) return false;
+        memset(storage, 0, blocks * sizeof(BloomBlock));
+        free(filter->blocks_);
+        filter->blocks_ = storage;
+        filter->block_mask_ = blocks - 1;
+    }
+
+    filter->capacity_ = capacity;
+    filter->items_ = 0;
+    return true;
+}
+
+void bloom_add(BloomFilter* filter, const void* value) {
+    uint64_t hash = filter->hash_(value, filter->user_data_);
+    BloomBlock* block = &filter->blocks_[block_index(filter, hash)];
+
+    for (unsigned i = 0; i < filter->hashes_; i++) {
+        unsigned bit = probe_bit(hash, i);
+        block->words_[bit / 64] |= (uint64_t)1 << (bit % 64);
+    }
+    filter->items_++;
+}
+
+bool bloom_may_contain(const BloomFilter* filter, const void* value) {
+    uint64_t hash = filter->hash_(value, filter->user_data_);
+    const BloomBlock* block = &filter->blocks_[block_index(filter, hash)];
+
+    for (unsigned i = 0; i < filter->hashes_; i++) {
+        unsigned bit = probe_bit(hash, i);
+        if (!(block->words_[bit / 64] & ((uint64_t)1 << (bit % 64)))) return false;
+    }
+    return true;
+}
+
+size_t bloom_items(const BloomFilter* filter) {
+    return filter->items_;
+}
+
+size_t bloom_capacity(const BloomFilter* filter) {
+    return filter->capacity_;
+}
+
+double bloom_estimated_fpr(const BloomFilter* filter) {
+    // Averaged per block: a query only sees the fill of the block it hashes
+    // to, and uneven block loads dominate the rate of a blocked filter.
+    size_t blocks = filter->block_mask_ + 1;
+    double total = 0.0;
+    for (size_t b = 0; b < blocks; b++) {
+        size_t set = 0;
+        for (size_t w = 0; w < BLOOM_BLOCK_WORDS; w++) set += count_ones(filter->blocks_[b].words_[w]);
+
+        double fill = (double)set / (BLOOM_BLOCK_WORDS * 64);
+        double fpr = 1.0;
+        for (unsigned i = 0; i < filter->hashes_; i++) fpr *= fill;
+        total += fpr;
+    }
+    return total / (double)blocks;
+}
+
+double bloom_observed_fpr(const BloomStats* stats) {
+    uint64_t negatives = stats->filtered_ + stats->false_positives_;
+    return negatives ? (double)stats->false_positives_ / (double)negatives : 0.0;
+}
@@ -0,0 +1,75 @@
+#include "filters/list_filter.h"
+
+static size_t capacity_for(size_t items) {
+    return items < 32 ? 64 : items * 2;
+}
+
+static bool fill_filter(ListFilter* filter, size_t capacity, list_filter_fill_fn fill, const void* list) {
+    if (!bloom_reset(filter->bloom_, capacity)) return false;
+
+    fill(list, filter->bloom_);
+    filter->stats_.erased_since_rebuild_ = 0;
+    return true;
+}
+
+void list_filter_init(ListFilter* filter) {
+    filter->bloom_ = NULL;
+    filter->stats_ = (BloomStats){0};
+}
+
+bool list_filter_enable(ListFilter* filter, size_t items, size_t bits_per_item, bloom_hash_fn hash, void* user_data,
+                        list_filter_fill_fn fill, const void* list) {
+    list_filter_disable(filter);
+
+    filter->bloom_ = bloom_new(capacity_for(items), bits_per_item, hash, user_data);
+    if (!filter->bloom_) return false;
+
+    filter->stats_ = (BloomStats){0};
+    if (fill_filter(filter, bloom_capacity(filter->bloom_), fill, list)) return true;
+
+    // An empty filter would reject every search
+    list_filter_disable(filter);
+    return false;
+}
+
+void list_filter_disable(ListFilter* filter) {
+    bloom_free(filter->bloom_);
+    filter->bloom_ = NULL;
+}
+
+bool list_filter_rebuild(ListFilter* filter, size_t items, list_filter_fill_fn fill, const void* list) {
+    if (!filter->bloom_) return false;
+    if (fill_filter(filter, capacity_for(items), fill, list)) return true;
+
+    list_filter_disable(filter);
+    return false;
+}
+
+void list_filter_added(ListFilter* filter, const void* value, size_t items, list_filter_fill_fn fill, const void* list) {
+    if (!filter->bloom_) return;
+
+    if (bloom_items(filter->bloom_) < bloom_capacity(filter->bloom_)) {
+        bloom_add(filter->bloom_, value);
+    } else {
+        // Without a filter search() is still correct, just slower
+        list_filter_rebuild(filter, items, fill, list);
+    }
+}
+
+void list_filter_erased(ListFilter* filter) {
+    if (filter->bloom_) filter->stats_.erased_since_rebuild_++;
+}
+
+bool list_filter_rejects(ListFilter* filter, const void* value) {
+    if (!filter->bloom_) return false;
+
+    filter->stats_.searches_++;
+    if (bloom_may_contain(filter->bloom_, value)) return false;
+
+    filter->stats_.filtered_++;
+    return true;
+}
+
+void list_filter_missed(ListFilter* filter) {
+    if (filter->bloom_) filter->stats_.false_positives_++;
+}
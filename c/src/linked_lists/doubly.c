@@ -21,10 +21,48 @@ DoublyLinkedList* doubly_list_new() {
     new_list->head_ = head_sentinel;
     new_list->tail_ = tail_sentinel;
     new_list->size_ = 0;
+    list_filter_init(&new_list->filter_);
 
     return new_list;
 }
 
+void doubly_list_free(DoublyLinkedList* list) {
+    clear(list);
+    list_filter_disable(&list->filter_);
+    free(list->head_);
+    free(list->tail_);
+    free(list);
+}
+
+static void fill_values(const void* list, BloomFilter* bloom) {
+    const DoublyLinkedList* doubly = list;
+    for (Node* curr = doubly->head_->next_; curr != doubly->tail_; curr = curr->next_) bloom_add(bloom, curr->value_);
+}
+
+static void filter_added(DoublyLinkedList* list, void* value) {
+    list_filter_added(&list->filter_, value, list->size_, fill_values, list);
+}
+
+static void filter_erased(DoublyLinkedList* list) {
+    list_filter_erased(&list->filter_);
+}
+
+bool doubly_list_enable_filter(DoublyLinkedList* list, size_t bits_per_item, bloom_hash_fn hash, void* user_data) {
+    return list_filter_enable(&list->filter_, list->size_, bits_per_item, hash, user_data, fill_values, list);
+}
+
+void doubly_list_disable_filter(DoublyLinkedList* list) {
+    list_filter_disable(&list->filter_);
+}
+
+bool doubly_list_rebuild_filter(DoublyLinkedList* list) {
+    return list_filter_rebuild(&list->filter_, list->size_, fill_values, list);
+}
+
+BloomStats doubly_list_filter_stats(const DoublyLinkedList* list) {
+    return list->filter_.stats_;
+}
+
 size_t size(DoublyLinkedList* list) {
     return list->size_;
 }
@@ -61,29 +99,38 @@ void* at(DoublyLinkedList* list, size_t pos) {
 }
 
 Node* search(DoublyLinkedList* list, void* value) {
+    if (list_filter_rejects(&list->filter_, value)) return NULL;
+
     Node* curr = list->head_->next_;
     while (curr != list->tail_) {
         if (curr->value_ == value) return curr;
+        curr = curr->next_;
     }
+
+    list_filter_missed(&list->filter_);
     return NULL;
 }
 
-void push_front(DoublyLinkedList* list, void* value) {
+Node* push_front(DoublyLinkedList* list, void* value) {
     Node* new_node = node_new(value, list->head_->next_, list->head_);
+    list->head_->next_->prev_ = new_node;
     list->head_->next_ = new_node;
 
-    if (list->size_ == 0) list->tail_->prev_ = new_node;
-
     list->size_++;
+    filter_added(list, value);
+
+    return new_node;
 }
 
-void push_back(DoublyLinkedList* list, void* value) {
+Node* push_back(DoublyLinkedList* list, void* value) {
     Node *new_node = node_new(value, list->tail_, list->tail_->prev_); 
+    list->tail_->prev_->next_ = new_node;
     list->tail_->prev_ = new_node;
 
-    if (list->size_ == 0) list->head_->next_ = new_node;
-
     list->size_++;
+    filter_added(list, value);
+
+    return new_node;
 }
 
 void insert(DoublyLinkedList* list, size_t pos, void* value) {
@@ -107,9 +154,34 @@ void insert(DoublyLinkedList* list, size_t pos, void* value) {
         new_node->next_->prev_ = new_node;
 
         list->size_++;
+        filter_added(list, value);
     }
 }
 
+void move_to_front(DoublyLinkedList* list, Node* node) {
+    if (list->head_->next_ == node) return;
+
+    node->prev_->next_ = node->next_;
+    node->next_->prev_ = node->prev_;
+
+    node->next_ = list->head_->next_;
+    node->prev_ = list->head_;
+    list->head_->next_->prev_ = node;
+    list->head_->next_ = node;
+}
+
+void* remove_node(DoublyLinkedList* list, Node* node) {
+    node->prev_->next_ = node->next_;
+    node->next_->prev_ = node->prev_;
+
+    void* removed_value = node->value_;
+    free(node);
+    list->size_--;
+    filter_erased(list);
+
+    return removed_value;
+}
+
 void* pop_front(DoublyLinkedList* list) {
     if (list->size_ == 0) return NULL;
 
@@ -120,6 +192,7 @@ void* pop_front(DoublyLinkedList* list) {
     free(prev_head);
 
     list->size_--;
+    filter_erased(list);
 
     return prev_head_value;
 }
@@ -134,6 +207,7 @@ void* pop_back(DoublyLinkedList* list) {
     free(prev_tail);
 
     list->size_--;
+    filter_erased(list);
 
     return prev_tail_value;
 }
@@ -161,6 +235,7 @@ void* erase(DoublyLinkedList* list, size_t pos) {
 
         free(curr);
         list->size_--;
+        filter_erased(list);
         
         return deleted_node_value;
     }
@@ -168,6 +243,7 @@ void* erase(DoublyLinkedList* list, size_t pos) {
 
 void clear(DoublyLinkedList* list) {
     while (list->size_ != 0) pop_front(list);
+    doubly_list_rebuild_filter(list);
 }
 
 Node* find_middle(Node* head) {
@@ -241,6 +317,7 @@ DoublyLinkedList* merge(DoublyLinkedList* list_1, DoublyLinkedList* list_2) {
     new_list->head_ = list_1->head_;
     new_list->tail_ = list_2->tail_;
     new_list->size_ = list_1->size_ + list_2->size_;
+    list_filter_init(&new_list->filter_);
 
     list_1->tail_->prev_->next_ = list_2->head_->next_;
     list_2->head_->next_->prev_ = list_1->tail_->prev_;
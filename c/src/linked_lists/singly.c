@@ -18,10 +18,46 @@ SinglyLinkedList* singly_list_new() {
     new_list->sentinel_ = sentinel;
     new_list->tail_ = sentinel;
     new_list->size_ = 0;
+    list_filter_init(&new_list->filter_);
 
     return new_list;
 }
 
+void singly_list_free(SinglyLinkedList* list) {
+    clear(list);
+    list_filter_disable(&list->filter_);
+    free(list->sentinel_);
+    free(list);
+}
+
+static void fill_values(const void* list, BloomFilter* bloom) {
+    for (Node* curr = ((const SinglyLinkedList*)list)->sentinel_->next_; curr; curr = curr->next_) bloom_add(bloom, curr->value_);
+}
+
+static void filter_added(SinglyLinkedList* list, void* value) {
+    list_filter_added(&list->filter_, value, list->size_, fill_values, list);
+}
+
+static void filter_erased(SinglyLinkedList* list) {
+    list_filter_erased(&list->filter_);
+}
+
+bool singly_list_enable_filter(SinglyLinkedList* list, size_t bits_per_item, bloom_hash_fn hash, void* user_data) {
+    return list_filter_enable(&list->filter_, list->size_, bits_per_item, hash, user_data, fill_values, list);
+}
+
+void singly_list_disable_filter(SinglyLinkedList* list) {
+    list_filter_disable(&list->filter_);
+}
+
+bool singly_list_rebuild_filter(SinglyLinkedList* list) {
+    return list_filter_rebuild(&list->filter_, list->size_, fill_values, list);
+}
+
+BloomStats singly_list_filter_stats(const SinglyLinkedList* list) {
+    return list->filter_.stats_;
+}
+
 size_t size(SinglyLinkedList* list) {
     return list->size_;
 }
@@ -44,17 +80,22 @@ void* at(SinglyLinkedList* list, size_t pos) {
     if (pos == 0) return front(list);
     else if (pos == list->size_-1) return back(list);
     else {
-        Node* curr = list->sentinel_;
+        Node* curr = list->sentinel_->next_;
         while (pos--) curr = curr->next_;
         return curr->value_;
     }
 }
 
 Node* search(SinglyLinkedList* list, void* value) {
+    if (list_filter_rejects(&list->filter_, value)) return NULL;
+
     Node* curr = list->sentinel_->next_;
     while (curr) {
         if (curr->value_ == value) return curr;
+        curr = curr->next_;
     }
+
+    list_filter_missed(&list->filter_);
     return NULL;
 }
 
@@ -65,6 +106,7 @@ void push_front(SinglyLinkedList* list, void* value) {
     if (list->size_ == 0) list->tail_ = new_node;
 
     list->size_++;
+    filter_added(list, value);
 }
 
 void push_back(SinglyLinkedList* list, void* value) {
@@ -75,6 +117,7 @@ void push_back(SinglyLinkedList* list, void* value) {
     list->tail_ = new_node;
 
     list->size_++;
+    filter_added(list, value);
 }
 
 void insert(SinglyLinkedList* list, size_t pos, void* value) {
@@ -90,6 +133,7 @@ void insert(SinglyLinkedList* list, size_t pos, void* value) {
         curr->next_ = new_node;
 
         list->size_++;
+        filter_added(list, value);
     }
 }
 
@@ -103,6 +147,7 @@ void* pop_front(SinglyLinkedList* list) {
     if (list->size_ == 1) list->tail_ = list->sentinel_;
 
     list->size_--;
+    filter_erased(list);
 
     return prev_head_value;
 }
@@ -120,18 +165,19 @@ void* pop_back(SinglyLinkedList* list) {
     list->tail_->next_ = NULL;
 
     list->size_--;
+    filter_erased(list);
 
     return prev_tail_value;
 }
 
 void* erase(SinglyLinkedList* list, size_t pos) {
-    if (pos < 0 || pos > list->size_) return NULL;
+    if (pos < 0 || pos >= list->size_) return NULL;
 
     if (pos == 0) return pop_front(list);
     else if (pos == list->size_-1) return pop_back(list);
     else {
         Node* curr = list->sentinel_;
-        while (curr--) curr = curr->next_;
+        while (pos--) curr = curr->next_;
 
         Node* node_to_delete = curr->next_;
         void* deleted_node_value = node_to_delete->value_;
@@ -139,6 +185,7 @@ void* erase(SinglyLinkedList* list, size_t pos) {
         free(node_to_delete);
 
         list->size_--;
+        filter_erased(list);
 
         return deleted_node_value;
     }
@@ -146,6 +193,7 @@ void* erase(SinglyLinkedList* list, size_t pos) {
 
 void clear(SinglyLinkedList* list) {
     while (list->size_ != 0) pop_front(list);
+    singly_list_rebuild_filter(list);
 }
 
 Node* find_middle(Node* head) {
@@ -177,6 +225,7 @@ Node* merge_helper(Node* head_1, Node* head_2) {
 
         curr = curr->next_;
     }
+    curr->next_ = head_1 ? head_1 : head_2;
 
     Node* sorted_head = dummy->next_;
     free(dummy);
@@ -198,7 +247,11 @@ Node* sort_list(Node* head) {
 }
 
 void sort(SinglyLinkedList* list) {
-    list->sentinel_ = sort_list(list->sentinel_->next_);
+    list->sentinel_->next_ = sort_list(list->sentinel_->next_);
+
+    Node* curr = list->sentinel_;
+    while (curr->next_) curr = curr->next_;
+    list->tail_ = curr;
 }
 
 SinglyLinkedList* merge(SinglyLinkedList* list_1, SinglyLinkedList* list_2) {
@@ -209,6 +262,7 @@ SinglyLinkedList* merge(SinglyLinkedList* list_1, SinglyLinkedList* list_2) {
     new_list->sentinel_ = list_1->sentinel_;
     new_list->tail_ = list_2->tail_;
     new_list->size_ = list_1->size_ + list_2->size_;
+    list_filter_init(&new_list->filter_);
 
     list_1->tail_->next_ = list_2->sentinel_->next_;
     free(list_2->sentinel_);
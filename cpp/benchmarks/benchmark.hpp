@@ -0,0 +1,81 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+#include "perf_counters.hpp"
+
+namespace bench {
+
+template <typename T>
+inline void do_not_optimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+struct Result {
+    std::string name;
+    std::size_t ops;
+    double seconds;
+    std::size_t bytes = 0;
+    PerfSample counters;
+};
+
+// Runs fn `repetitions` times and keeps the fastest run, together with the
+// hardware counters read around it; fn performs `ops` operations per call.
+template <typename Fn>
+Result run(const std::string& name, std::size_t ops, Fn&& fn, int repetitions = 5) {
+    PerfCounters counters;
+
+    Result result{name, ops, std::numeric_limits<double>::max(), 0, {}};
+    for (int i = 0; i < repetitions; i++) {
+        counters.start();
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        PerfSample sample = counters.stop();
+
+        if (elapsed.count() < result.seconds) {
+            result.seconds = elapsed.count();
+            result.counters = sample;
+        }
+    }
+    return result;
+}
+
+inline void report(const Result& result) {
+    double nsPerOp = result.seconds * 1e9 / static_cast<double>(result.ops);
+    double mopsPerSec = static_cast<double>(result.ops) / result.seconds / 1e6;
+    std::printf("%-48s %12.2f ns/op %12.2f Mops/s", result.name.c_str(), nsPerOp, mopsPerSec);
+    if (result.bytes > 0) std::printf(" %12.2f MB/s", static_cast<double>(result.bytes) / result.seconds / 1e6);
+    std::printf("\n");
+
+    static bool warned = false;
+    if (!result.counters.any()) {
+        if (!warned) std::printf("    (hardware counters unavailable, reporting wall clock only)\n");
+        warned = true;
+        return;
+    }
+
+    double ops = static_cast<double>(result.ops);
+    std::printf("    ");
+    for (std::size_t i = 0; i < perfEventCount; i++) {
+        auto event = static_cast<PerfEvent>(i);
+        if (!result.counters.has(event)) continue;
+        std::printf(" %s/op %.2f", perf_event_name(event), static_cast<double>(result.counters[event]) / ops);
+    }
+    if (result.counters.has(PerfEvent::cycles) && result.counters.has(PerfEvent::instructions) && result.counters[PerfEvent::cycles] > 0) {
+        std::printf(" IPC %.2f", static_cast<double>(result.counters[PerfEvent::instructions]) / static_cast<double>(result.counters[PerfEvent::cycles]));
+    }
+    std::printf("\n");
+}
+
+inline std::size_t size_arg(int argc, char** argv, std::size_t fallback) {
+    return argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : fallback;
+}
+
+}
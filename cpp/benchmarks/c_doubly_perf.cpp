@@ -0,0 +1,34 @@
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "benchmark.hpp"
+
+extern "C" {
+#include "linked_lists/doubly.h"
+}
+
+// The C list stores void*; integers ride in the pointer bits.
+static void* box(std::uintptr_t value) { return reinterpret_cast<void*>(value); }
+static std::uintptr_t unbox(void* value) { return reinterpret_cast<std::uintptr_t>(value); }
+
+int main(int argc, char** argv) {
+    std::size_t n = bench::size_arg(argc, argv, 1'000'000);
+
+    DoublyLinkedList* list = doubly_list_new();
+    bench::report(bench::run("c doubly push_back", n, [&] {
+        for (std::size_t i = 0; i < n; i++) push_back(list, box(i));
+    }, 1));
+
+    bench::report(bench::run("c doubly traverse via at()", 1000, [&] {
+        std::uintptr_t sum = 0;
+        for (std::size_t i = 0; i < 1000; i++) sum += unbox(at(list, (i * 7919) % n));
+        bench::do_not_optimize(sum);
+    }, 1));
+
+    bench::report(bench::run("c doubly pop_back", n, [&] {
+        std::uintptr_t sum = 0;
+        while (!is_empty(list)) sum += unbox(pop_back(list));
+        bench::do_not_optimize(sum);
+    }, 1));
+}
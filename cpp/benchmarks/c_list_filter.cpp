@@ -0,0 +1,52 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+
+extern "C" {
+#include "linked_lists/singly.h"
+}
+
+static void* box(std::uintptr_t value) { return reinterpret_cast<void*>(value); }
+
+// The dedup path: 95% of lookups are for values that are not in the list
+static bench::Result lookups(const std::string& name, SinglyLinkedList* list, const std::vector<std::uintptr_t>& keys) {
+    return bench::run(name, keys.size(), [&] {
+        std::size_t found = 0;
+        for (std::uintptr_t key : keys) found += search(list, box(key)) != nullptr;
+        bench::do_not_optimize(found);
+    }, 3);
+}
+
+int main(int argc, char** argv) {
+    std::size_t max = bench::size_arg(argc, argv, 1'000'000);
+
+    std::mt19937_64 rng(42);
+    for (std::size_t n = 1'000; n <= max; n *= 10) {
+        SinglyLinkedList* list = singly_list_new();
+        for (std::size_t i = 0; i < n; i++) push_back(list, box(2 * i + 2));
+
+        std::size_t count = std::max<std::size_t>(200, 20'000'000 / n);
+        std::vector<std::uintptr_t> keys(count);
+        for (auto& key : keys) {
+            std::uintptr_t i = rng() % n;
+            key = rng() % 100 < 95 ? 2 * i + 1 : 2 * i + 2;
+        }
+
+        std::string suffix = " n=" + std::to_string(n);
+        bench::report(lookups("c singly search, 95% misses" + suffix, list, keys));
+
+        singly_list_enable_filter(list, 10, nullptr, nullptr);
+        bench::report(lookups("c singly search + bloom, 95% misses" + suffix, list, keys));
+
+        BloomStats stats = singly_list_filter_stats(list);
+        std::printf("    false positives: observed %.5f, estimated %.5f\n",
+                    bloom_observed_fpr(&stats), bloom_estimated_fpr(list->filter_.bloom_));
+
+        singly_list_free(list);
+    }
+}
@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark.hpp"
+
+extern "C" {
+#include "caches/lru_cache.h"
+}
+
+// Zipfian trace over `keys` keys with exponent s, drawn by inverting the CDF.
+static std::vector<std::uint64_t> zipfTrace(std::size_t keys, double s, std::size_t length, std::uint64_t seed) {
+    std::vector<double> cdf(keys);
+    double total = 0;
+    for (std::size_t k = 0; k < keys; k++) cdf[k] = total += 1.0 / std::pow(double(k + 1), s);
+
+    // Ranks are scattered over the key space so hot keys are not neighbours
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> uniform(0, total);
+    std::vector<std::uint64_t> trace(length);
+    for (auto& key : trace) {
+        auto rank = std::size_t(std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin());
+        key = rank * 0x9e3779b97f4a7c15ULL;
+    }
+    return trace;
+}
+
+static void* box(std::uint64_t value) { return reinterpret_cast<void*>(static_cast<std::uintptr_t>(value)); }
+
+// Read-through usage: a miss is followed by a put of the fetched value.
+static void singleThreaded(const std::vector<std::uint64_t>& trace, std::size_t capacity, double s) {
+    LruCache* cache = lru_cache_new(capacity, nullptr, nullptr);
+
+    std::size_t hits = 0;
+    auto result = bench::run("lru_cache s=" + std::to_string(s).substr(0, 4) + " capacity=" + std::to_string(capacity),
+                             trace.size(), [&] {
+        hits = 0;
+        for (std::uint64_t key : trace) {
+            void* value;
+            if (lru_cache_get(cache, key, &value)) hits++;
+            else lru_cache_put(cache, key, box(key));
+        }
+    }, 3);
+    bench::report(result);
+    std::printf("    hit rate %.3f\n", double(hits) / double(trace.size()));
+
+    lru_cache_free(cache);
+}
+
+static void sharded(const std::vector<std::uint64_t>& trace, std::size_t capacity, std::size_t shards, unsigned threads) {
+    ShardedLruCache* cache = sharded_lru_cache_new(capacity, shards, nullptr, nullptr);
+
+    bench::report(bench::run("sharded_lru_cache shards=" + std::to_string(shards) + " threads=" + std::to_string(threads),
+                             trace.size(), [&] {
+        std::vector<std::thread> workers;
+        for (unsigned t = 0; t < threads; t++) {
+            workers.emplace_back([&, t] {
+                for (std::size_t i = t; i < trace.size(); i += threads) {
+                    void* value;
+                    if (!sharded_lru_cache_get(cache, trace[i], &value)) sharded_lru_cache_put(cache, trace[i], box(trace[i]));
+                }
+            });
+        }
+        for (auto& worker : workers) worker.join();
+    }, 3));
+
+    sharded_lru_cache_free(cache);
+}
+
+int main(int argc, char** argv) {
+    std::size_t length = bench::size_arg(argc, argv, 4'000'000);
+    constexpr std::size_t keys = 1'000'000;
+
+    for (double s : {0.8, 0.99, 1.2}) {
+        auto trace = zipfTrace(keys, s, length, 42);
+        for (std::size_t capacity : {keys / 100, keys / 10}) singleThreaded(trace, capacity, s);
+    }
+
+    auto trace = zipfTrace(keys, 0.99, length, 7);
+    for (std::size_t shards : {1, 16}) {
+        for (unsigned threads : {1u, 4u, 8u}) sharded(trace, keys / 10, shards, threads);
+    }
+}
@@ -0,0 +1,91 @@
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "chunked_deque.hpp"
+#include "stack.hpp"
+
+using Value = std::uint64_t;
+
+// Steady-state FIFO: the queue holds `depth` elements and every step pushes
+// at the back and pops at the front.
+template <class Queue>
+void queueWorkload(const std::string& name, std::size_t depth, std::size_t steps) {
+    bench::report(bench::run(name, steps * 2, [&] {
+        Queue queue;
+        for (std::size_t i = 0; i < depth; i++) queue.push_back(i);
+        Value sum = 0;
+        for (std::size_t i = 0; i < steps; i++) {
+            queue.push_back(i);
+            sum += queue.front();
+            queue.pop_front();
+        }
+        bench::do_not_optimize(sum);
+    }, 3));
+}
+
+// LIFO: push n, then pop n, at the back
+template <class Container, class Push, class Pop>
+void stackWorkload(const std::string& name, std::size_t n, Push push, Pop pop) {
+    bench::report(bench::run(name, n * 2, [&] {
+        Container container;
+        for (std::size_t i = 0; i < n; i++) push(container, i);
+        Value sum = 0;
+        for (std::size_t i = 0; i < n; i++) sum += pop(container);
+        bench::do_not_optimize(sum);
+    }, 3));
+}
+
+template <class Container>
+void randomAccess(const std::string& name, const Container& container, const std::vector<std::size_t>& positions) {
+    bench::report(bench::run(name, positions.size(), [&] {
+        Value sum = 0;
+        for (std::size_t pos : positions) sum += container[pos];
+        bench::do_not_optimize(sum);
+    }));
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = bench::size_arg(argc, argv, 10'000'000);
+
+    for (std::size_t depth : {std::size_t(64), std::size_t(100'000)}) {
+        std::string suffix = " depth=" + std::to_string(depth);
+        queueWorkload<std::deque<Value>>("std::deque queue" + suffix, depth, n);
+        queueWorkload<ChunkedDeque<Value>>("ChunkedDeque queue" + suffix, depth, n);
+    }
+
+    stackWorkload<Stack<Value>>("Stack stack", n,
+        [](Stack<Value>& s, Value v) { s.push(v); }, [](Stack<Value>& s) { return s.pop(); });
+    stackWorkload<std::deque<Value>>("std::deque stack", n,
+        [](std::deque<Value>& d, Value v) { d.push_back(v); },
+        [](std::deque<Value>& d) { Value v = d.back(); d.pop_back(); return v; });
+    stackWorkload<ChunkedDeque<Value>>("ChunkedDeque stack", n,
+        [](ChunkedDeque<Value>& d, Value v) { d.push_back(v); }, [](ChunkedDeque<Value>& d) { return d.pop_back(); });
+
+    std::vector<std::size_t> positions(n);
+    std::uint64_t state = 7;
+    for (std::size_t& pos : positions) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        pos = static_cast<std::size_t>((state >> 16) % n);
+    }
+
+    std::deque<Value> stdDeque;
+    ChunkedDeque<Value> chunked;
+    Stack<Value> stack;
+    for (std::size_t i = 0; i < n; i++) {
+        stdDeque.push_back(i);
+        chunked.push_back(i);
+        stack.push(i);
+    }
+
+    randomAccess("std::deque random access", stdDeque, positions);
+    randomAccess("ChunkedDeque random access", chunked, positions);
+    bench::report(bench::run("Stack random access (data())", positions.size(), [&] {
+        const Value* data = stack.data();
+        Value sum = 0;
+        for (std::size_t pos : positions) sum += data[pos];
+        bench::do_not_optimize(sum);
+    }));
+}
@@ -0,0 +1,97 @@
+#include <cstdint>
+#include <forward_list>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "concurrent_list.hpp"
+
+// The structure being replaced: a sorted list behind a reader/writer lock.
+class LockedSortedList {
+private:
+    std::forward_list<std::uint64_t> list_;
+    mutable std::shared_mutex mutex_;
+
+    auto before(std::uint64_t value) {
+        auto prev = list_.before_begin();
+        for (auto it = list_.begin(); it != list_.end() && *it < value; ++it) prev = it;
+        return prev;
+    }
+public:
+    bool insert(std::uint64_t value) {
+        std::unique_lock lock(mutex_);
+        auto prev = before(value);
+        auto next = std::next(prev);
+        if (next != list_.end() && *next == value) return false;
+        list_.insert_after(prev, value);
+        return true;
+    }
+
+    bool erase(std::uint64_t value) {
+        std::unique_lock lock(mutex_);
+        auto prev = before(value);
+        auto next = std::next(prev);
+        if (next == list_.end() || *next != value) return false;
+        list_.erase_after(prev);
+        return true;
+    }
+
+    bool contains(std::uint64_t value) const {
+        std::shared_lock lock(mutex_);
+        for (std::uint64_t v : list_) {
+            if (v >= value) return v == value;
+        }
+        return false;
+    }
+};
+
+// Each thread runs its share of `ops` operations over a key range that is
+// half populated; `readPercent` of them are lookups, the rest an even mix
+// of inserts and erases, so the set size stays stable.
+template <typename Set>
+static void mixed(const std::string& name, std::size_t ops, std::uint64_t keys, unsigned readPercent) {
+    for (unsigned threads : {1u, 2u, 4u, 8u, 16u, 32u, 64u}) {
+        Set set;
+        for (std::uint64_t k = 0; k < keys; k += 2) set.insert(k);
+
+        std::string label = name + " " + std::to_string(readPercent) + "/" + std::to_string(100 - readPercent) +
+                            " threads=" + std::to_string(threads);
+
+        bench::report(bench::run(label, ops, [&] {
+            std::vector<std::thread> workers;
+            for (unsigned t = 0; t < threads; t++) {
+                workers.emplace_back([&, t] {
+                    std::mt19937_64 rng(t + 1);
+                    std::size_t hits = 0;
+                    for (std::size_t i = 0; i < ops / threads; i++) {
+                        std::uint64_t key = rng() % keys;
+                        unsigned roll = static_cast<unsigned>(rng() % 100);
+                        if (roll < readPercent) {
+                            hits += set.contains(key);
+                        } else if (roll % 2 == 0) {
+                            hits += set.insert(key);
+                        } else {
+                            hits += set.erase(key);
+                        }
+                    }
+                    bench::do_not_optimize(hits);
+                });
+            }
+            for (auto& worker : workers) worker.join();
+        }, 3));
+    }
+}
+
+int main(int argc, char** argv) {
+    std::size_t ops = bench::size_arg(argc, argv, 200'000);
+    constexpr std::uint64_t keys = 1024;
+
+    for (unsigned readPercent : {90u, 50u}) {
+        mixed<LockedSortedList>("shared_mutex list", ops, keys, readPercent);
+        mixed<ConcurrentSortedList<std::uint64_t>>("lock-free list", ops, keys, readPercent);
+    }
+}
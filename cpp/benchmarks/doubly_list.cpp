@@ -0,0 +1,51 @@
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <string>
+
+#include "benchmark.hpp"
+#include "doubly_list.hpp"
+#include "list.hpp"
+
+// Fill from the back and drain from the back, the deque-style pattern that
+// is O(n) per pop on the singly list.
+template <typename List>
+static void drainBack(const std::string& name, std::size_t n) {
+    bench::report(bench::run(name, n * 2, [&] {
+        List list;
+        for (std::size_t i = 0; i < n; i++) list.push_back(i);
+        std::uint64_t sum = 0;
+        while (!list.empty()) {
+            sum += list.back();
+            list.pop_back();
+        }
+        bench::do_not_optimize(sum);
+    }, 3));
+}
+
+template <typename List>
+static void traverse(const std::string& name, std::size_t n) {
+    List list;
+    for (std::size_t i = 0; i < n; i++) list.push_back(i);
+
+    bench::report(bench::run(name, n * 2, [&] {
+        std::uint64_t sum = 0;
+        for (auto it = list.begin(); it != list.end(); ++it) sum += *it;
+        for (auto it = list.rbegin(); it != list.rend(); ++it) sum ^= *it;
+        bench::do_not_optimize(sum);
+    }));
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = bench::size_arg(argc, argv, 1'000'000);
+
+    drainBack<std::list<std::uint64_t>>("std::list push/pop_back", n);
+    drainBack<DoublyLinkedList<std::uint64_t>>("DoublyLinkedList push/pop_back", n);
+    drainBack<XorLinkedList<std::uint64_t>>("XorLinkedList push/pop_back", n);
+    // Quadratic, so only a slice
+    drainBack<SinglyLinkedList<std::uint64_t>>("SinglyLinkedList push/pop_back (n <= 20k)", std::min<std::size_t>(n, 20'000));
+
+    traverse<std::list<std::uint64_t>>("std::list traverse both ways", n);
+    traverse<DoublyLinkedList<std::uint64_t>>("DoublyLinkedList traverse both ways", n);
+    traverse<XorLinkedList<std::uint64_t>>("XorLinkedList traverse both ways", n);
+}
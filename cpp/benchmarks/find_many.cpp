@@ -0,0 +1,44 @@
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "find_many.hpp"
+#include "list.hpp"
+
+using List = SinglyLinkedList<std::uint64_t>;
+
+int main(int argc, char** argv) {
+    std::size_t n = bench::size_arg(argc, argv, 4'000'000);
+    constexpr std::size_t listLength = 64;
+    constexpr std::size_t lookups = 1'000'000;
+
+    // Nodes are appended to randomly chosen lists so that neighbours in a
+    // list are far apart in memory and every hop is a likely cache miss.
+    std::mt19937_64 rng(42);
+    std::vector<List> lists(n / listLength);
+    std::uniform_int_distribution<std::size_t> pickList(0, lists.size() - 1);
+    for (std::size_t i = 0; i < n; i++) lists[pickList(rng)].push_back(rng() % (listLength * 2));
+
+    std::vector<const List*> targets(lookups);
+    std::vector<std::uint64_t> keys(lookups);
+    for (std::size_t i = 0; i < lookups; i++) {
+        targets[i] = &lists[pickList(rng)];
+        keys[i] = rng() % (listLength * 4);
+    }
+    std::vector<const std::uint64_t*> out(lookups);
+
+    bench::report(bench::run("sequential find", lookups, [&] {
+        std::size_t hits = 0;
+        for (std::size_t i = 0; i < lookups; i++) hits += targets[i]->find(keys[i]) != nullptr;
+        bench::do_not_optimize(hits);
+    }));
+
+    for (std::size_t group : {1, 2, 4, 8, 16, 32}) {
+        bench::report(bench::run("find_many group=" + std::to_string(group), lookups, [&] {
+            find_many(targets, keys, out, group);
+            bench::do_not_optimize(out.data());
+        }));
+    }
+}
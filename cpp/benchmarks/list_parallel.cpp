@@ -0,0 +1,71 @@
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "list.hpp"
+
+// A few rounds of a 64-bit mix per element stand in for CPU-heavy work
+static std::uint64_t heavyHash(std::uint64_t x) {
+    for (int round = 0; round < 16; round++) {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+    }
+    return x ^ (x >> 33);
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = bench::size_arg(argc, argv, 10'000'000);
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+
+    SinglyLinkedList<std::uint64_t> list;
+    for (std::size_t i = 0; i < n; i++) list.push_back(i);
+
+    bench::report(bench::run("sequential sum", n, [&] {
+        std::uint64_t sum = 0;
+        for (auto it = list.cbegin(); it != list.cend(); ++it) sum += *it;
+        bench::do_not_optimize(sum);
+    }));
+
+    bench::report(bench::run("sequential hash", n, [&] {
+        std::uint64_t acc = 0;
+        for (auto it = list.cbegin(); it != list.cend(); ++it) acc ^= heavyHash(*it);
+        bench::do_not_optimize(acc);
+    }));
+
+    // First call after the list was built pays for the segment index
+    bench::report(bench::run("segment index rebuild + sum", n, [&] {
+        list.push_front(0);
+        list.pop_front();
+        bench::do_not_optimize(list.parallel_reduce(std::uint64_t(0), std::plus<>{}, std::identity{}, 1));
+    }));
+
+    std::vector<unsigned> threadCounts;
+    for (unsigned threads = 1; threads < cores; threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(cores);
+
+    for (unsigned threads : threadCounts) {
+        std::string suffix = " (" + std::to_string(threads) + " threads)";
+
+        bench::report(bench::run("parallel_reduce sum" + suffix, n, [&] {
+            bench::do_not_optimize(list.parallel_reduce(std::uint64_t(0), std::plus<>{}, std::identity{}, threads));
+        }));
+
+        bench::report(bench::run("parallel_reduce hash" + suffix, n, [&] {
+            bench::do_not_optimize(list.parallel_reduce(std::uint64_t(0), std::bit_xor<>{}, heavyHash, threads));
+        }));
+
+        bench::report(bench::run("parallel_for_each increment" + suffix, n, [&] {
+            list.parallel_for_each([](std::uint64_t& v) { v++; }, threads);
+        }));
+
+        bench::report(bench::run("parallel_transform hash" + suffix, n, [&] {
+            list.parallel_transform(heavyHash, threads);
+        }, 1));
+    }
+}
@@ -0,0 +1,46 @@
+#include <cstdint>
+#include <random>
+#include <ranges>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "list.hpp"
+
+// Filter-map-sum: keep odd values, square them, add them up
+static bool keep(std::uint64_t v) { return v & 1; }
+static std::uint64_t square(std::uint64_t v) { return v * v; }
+
+int main(int argc, char** argv) {
+    std::size_t n = bench::size_arg(argc, argv, 10'000'000);
+
+    std::mt19937_64 rng(42);
+    SinglyLinkedList<std::uint64_t> list;
+    for (std::size_t i = 0; i < n; i++) list.push_back(rng() % 1000);
+    const auto& view = list;
+
+    bench::report(bench::run("copy to vector, then loop", n, [&] {
+        std::vector<std::uint64_t> copy;
+        copy.reserve(view.size());
+        for (auto it = view.cbegin(); it != view.cend(); ++it) copy.push_back(*it);
+
+        std::uint64_t sum = 0;
+        for (std::uint64_t v : copy) {
+            if (keep(v)) sum += square(v);
+        }
+        bench::do_not_optimize(sum);
+    }));
+
+    bench::report(bench::run("hand-written loop over the list", n, [&] {
+        std::uint64_t sum = 0;
+        for (std::uint64_t v : view) {
+            if (keep(v)) sum += square(v);
+        }
+        bench::do_not_optimize(sum);
+    }));
+
+    bench::report(bench::run("views::filter | views::transform", n, [&] {
+        std::uint64_t sum = 0;
+        for (std::uint64_t v : view | std::views::filter(keep) | std::views::transform(square)) sum += v;
+        bench::do_not_optimize(sum);
+    }));
+}
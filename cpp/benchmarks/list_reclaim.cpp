@@ -0,0 +1,48 @@
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "benchmark.hpp"
+#include "list.hpp"
+
+// Caller-side cost of dropping a large list: the list is built outside the
+// timed region and only its destruction is measured.
+template <typename T, typename Build>
+static bench::Result destroy(const std::string& name, std::size_t n, ReclaimMode mode, bool compacted, Build build) {
+    auto list = std::make_unique<SinglyLinkedList<T>>();
+    list->set_reclaim_mode(mode);
+    for (std::size_t i = 0; i < n; i++) list->push_back(build(i));
+    if (compacted) list->compact();
+
+    auto result = bench::run(name, n, [&] { list.reset(); }, 1);
+    NodeReclaimer::global().drain();
+    return result;
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = bench::size_arg(argc, argv, 10'000'000);
+
+    std::mt19937_64 rng(42);
+    auto number = [&](std::size_t) { return rng(); };
+    auto text = [&](std::size_t) { return std::string(24 + rng() % 16, 'x'); };
+
+    bench::report(destroy<std::uint64_t>("uint64 immediate", n, ReclaimMode::immediate, false, number));
+    bench::report(destroy<std::uint64_t>("uint64 background", n, ReclaimMode::background, false, number));
+    bench::report(destroy<std::uint64_t>("uint64 arena (compacted)", n, ReclaimMode::immediate, true, number));
+
+    std::size_t strings = n / 4;
+    bench::report(destroy<std::string>("string immediate", strings, ReclaimMode::immediate, false, text));
+    bench::report(destroy<std::string>("string background", strings, ReclaimMode::background, false, text));
+    bench::report(destroy<std::string>("string arena (compacted)", strings, ReclaimMode::immediate, true, text));
+
+    auto drain = bench::run("background drain after drop", n, [&] {
+        auto list = std::make_unique<SinglyLinkedList<std::uint64_t>>();
+        list->set_reclaim_mode(ReclaimMode::background);
+        for (std::size_t i = 0; i < n; i++) list->push_back(i);
+        list.reset();
+        NodeReclaimer::global().drain();
+    }, 1);
+    bench::report(drain);
+}
@@ -0,0 +1,65 @@
+#include <cstdint>
+#include <algorithm>
+#include <forward_list>
+#include <random>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "list.hpp"
+
+using List = SinglyLinkedList<std::uint64_t>;
+
+static bool doomed(std::uint64_t v) { return v % 10 == 0; }
+
+static std::vector<std::uint64_t> values(std::size_t n) {
+    std::mt19937_64 rng(42);
+    std::vector<std::uint64_t> out(n);
+    for (auto& v : out) v = rng();
+    return out;
+}
+
+// Index-based filtering, the only option before remove_if: every erase(pos)
+// walks from the front again, so this is O(n*k).
+static void eraseByIndex(std::size_t n) {
+    auto input = values(n);
+    List list;
+    for (auto v : input) list.push_back(v);
+
+    bench::report(bench::run("erase(pos) loop", n, [&] {
+        std::size_t pos = 0;
+        for (auto v : input) {
+            if (doomed(v)) list.erase(pos);
+            else pos++;
+        }
+    }, 1));
+}
+
+static void removeIf(std::size_t n, bool compacted) {
+    auto input = values(n);
+    List list;
+    for (auto v : input) list.push_back(v);
+    if (compacted) list.compact();
+
+    bench::report(bench::run(compacted ? "remove_if (compacted)" : "remove_if", n, [&] {
+        bench::do_not_optimize(list.remove_if(doomed));
+    }, 1));
+}
+
+static void forwardList(std::size_t n) {
+    auto input = values(n);
+    std::forward_list<std::uint64_t> list(input.begin(), input.end());
+
+    bench::report(bench::run("std::forward_list::remove_if", n, [&] {
+        bench::do_not_optimize(list.remove_if(doomed));
+    }, 1));
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = bench::size_arg(argc, argv, 10'000'000);
+
+    // The quadratic baseline only runs on a slice of the input
+    eraseByIndex(std::min<std::size_t>(n, 20'000));
+    removeIf(n, false);
+    removeIf(n, true);
+    forwardList(n);
+}
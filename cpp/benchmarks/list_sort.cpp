@@ -0,0 +1,67 @@
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "list.hpp"
+
+// Each strategy sorts a fresh copy of the same list; building the copy is
+// outside the timed region.
+template <typename T>
+static void compare(const std::string& label, const std::vector<T>& values) {
+    const std::pair<SortStrategy, const char*> strategies[] = {
+        {SortStrategy::merge, "merge"},
+        {SortStrategy::pointer_array, "pointer array"},
+        {SortStrategy::radix, "radix"},
+        {SortStrategy::automatic, "automatic"},
+    };
+
+    for (auto [strategy, name] : strategies) {
+        if (strategy == SortStrategy::radix && !RadixKey<T>) continue;
+
+        bench::Result best;
+        for (int rep = 0; rep < 3; rep++) {
+            SinglyLinkedList<T> list;
+            for (const T& v : values) list.push_back(v);
+            auto result = bench::run(label + " " + name, values.size(), [&] { list.sort(strategy); }, 1);
+            if (rep == 0 || result.seconds < best.seconds) best = result;
+        }
+        bench::report(best);
+    }
+}
+
+int main(int argc, char** argv) {
+    std::size_t max = bench::size_arg(argc, argv, 1'000'000);
+
+    std::mt19937_64 rng(42);
+    for (std::size_t n = 1'000; n <= max; n *= 10) {
+        std::printf("--- %zu elements ---\n", n);
+
+        std::vector<std::uint32_t> uniform32(n);
+        for (auto& v : uniform32) v = static_cast<std::uint32_t>(rng());
+        compare("uint32 uniform", uniform32);
+
+        std::vector<std::uint64_t> uniform64(n);
+        for (auto& v : uniform64) v = rng();
+        compare("uint64 uniform", uniform64);
+
+        std::vector<std::uint64_t> narrow(n);
+        for (auto& v : narrow) v = rng() % 1000;
+        compare("uint64 in [0, 1000)", narrow);
+
+        std::vector<std::uint64_t> presorted(n);
+        for (std::size_t i = 0; i < n; i++) presorted[i] = i;
+        compare("uint64 presorted", presorted);
+
+        std::vector<float> normal(n);
+        std::normal_distribution<float> dist(0.0f, 100.0f);
+        for (auto& v : normal) v = dist(rng);
+        compare("float normal", normal);
+
+        std::vector<std::string> strings(n);
+        for (auto& s : strings) s = std::to_string(rng());
+        compare("string", strings);
+    }
+}
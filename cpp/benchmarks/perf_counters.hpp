@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace bench {
+
+enum class PerfEvent : std::uint8_t {
+    cycles,
+    instructions,
+    l1dMisses,
+    llcMisses,
+    dtlbMisses,
+    branchMisses,
+};
+
+inline constexpr std::size_t perfEventCount = static_cast<std::size_t>(PerfEvent::branchMisses) + 1;
+
+struct PerfSample {
+    std::array<std::uint64_t, perfEventCount> values{};
+    std::array<bool, perfEventCount> valid{};
+
+    bool any() const noexcept;
+    std::uint64_t operator[](PerfEvent event) const noexcept;
+    bool has(PerfEvent event) const noexcept;
+};
+
+// Linux perf_event_open counters for the calling thread. Each event is opened
+// on its own so a PMU or container that lacks one event still reports the
+// rest; events that cannot be opened are marked invalid in every sample.
+class PerfCounters {
+private:
+    std::array<int, perfEventCount> fds_;
+public:
+    PerfCounters() noexcept;
+    PerfCounters(const PerfCounters& other) = delete;
+
+    ~PerfCounters() noexcept;
+
+    PerfCounters& operator=(const PerfCounters& other) = delete;
+
+    bool available() const noexcept;
+
+    void start() noexcept;
+    PerfSample stop() noexcept;
+};
+
+const char* perf_event_name(PerfEvent event) noexcept;
+
+}
+
+#include "perf_counters.inl"
@@ -0,0 +1,115 @@
+#include "perf_counters.hpp"
+
+#include <cstring>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace bench {
+
+// ### PerfSample ###
+
+inline bool PerfSample::any() const noexcept {
+    for (bool v : valid) if (v) return true;
+    return false;
+}
+
+inline std::uint64_t PerfSample::operator[](PerfEvent event) const noexcept {
+    return values[static_cast<std::size_t>(event)];
+}
+
+inline bool PerfSample::has(PerfEvent event) const noexcept {
+    return valid[static_cast<std::size_t>(event)];
+}
+
+// ### PerfCounters ###
+
+namespace perf_detail {
+
+struct EventConfig {
+    std::uint32_t type;
+    std::uint64_t config;
+};
+
+inline constexpr std::uint64_t cacheMiss(std::uint64_t cache) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+inline constexpr std::array<EventConfig, perfEventCount> events = {{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_L1D)},
+    {PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_LL)},
+    {PERF_TYPE_HW_CACHE, cacheMiss(PERF_COUNT_HW_CACHE_DTLB)},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+}};
+
+inline int open(const EventConfig& event) noexcept {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = event.type;
+    attr.config = event.config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+}
+
+inline PerfCounters::PerfCounters() noexcept {
+    for (std::size_t i = 0; i < perfEventCount; i++) fds_[i] = perf_detail::open(perf_detail::events[i]);
+}
+
+inline PerfCounters::~PerfCounters() noexcept {
+    for (int fd : fds_) if (fd >= 0) ::close(fd);
+}
+
+inline bool PerfCounters::available() const noexcept {
+    for (int fd : fds_) if (fd >= 0) return true;
+    return false;
+}
+
+inline void PerfCounters::start() noexcept {
+    for (int fd : fds_) {
+        if (fd < 0) continue;
+        ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+inline PerfSample PerfCounters::stop() noexcept {
+    for (int fd : fds_) if (fd >= 0) ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+
+    PerfSample sample;
+    for (std::size_t i = 0; i < perfEventCount; i++) {
+        // value, time enabled, time running
+        std::uint64_t data[3];
+        if (fds_[i] < 0 || ::read(fds_[i], data, sizeof(data)) != sizeof(data) || data[2] == 0) continue;
+
+        // Scale up when the kernel multiplexed the counter off the PMU.
+        double scale = static_cast<double>(data[1]) / static_cast<double>(data[2]);
+        sample.values[i] = static_cast<std::uint64_t>(static_cast<double>(data[0]) * scale);
+        sample.valid[i] = true;
+    }
+    return sample;
+}
+
+inline const char* perf_event_name(PerfEvent event) noexcept {
+    switch (event) {
+        case PerfEvent::cycles: return "cycles";
+        case PerfEvent::instructions: return "instr";
+        case PerfEvent::l1dMisses: return "L1d-miss";
+        case PerfEvent::llcMisses: return "LLC-miss";
+        case PerfEvent::dtlbMisses: return "dTLB-miss";
+        case PerfEvent::branchMisses: return "br-miss";
+    }
+    return "?";
+}
+
+}
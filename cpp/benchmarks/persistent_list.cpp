@@ -0,0 +1,111 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "list.hpp"
+#include "persistent_list.hpp"
+
+using Table = SinglyLinkedList<std::uint64_t>;
+
+// Publishing a new version of an n-entry table: the status quo deep-copies
+// the list, the persistent list shares everything but the new head.
+static void publish(std::size_t n, std::size_t updates) {
+    std::string suffix = " n=" + std::to_string(n);
+
+    Table seed;
+    PersistentList<std::uint64_t> persistentSeed;
+    for (std::size_t i = 0; i < n; i++) {
+        seed.push_back(i);
+        persistentSeed = persistentSeed.push_front(i);
+    }
+
+    std::atomic<std::shared_ptr<const Table>> copied(std::make_shared<const Table>(seed));
+    bench::report(bench::run("copy-on-publish" + suffix, updates, [&] {
+        for (std::size_t u = 0; u < updates; u++) {
+            auto next = std::make_shared<Table>(*copied.load());
+            next->pop_front();
+            next->push_front(u);
+            copied.store(std::move(next));
+        }
+    }, 3));
+
+    AtomicPersistentList<std::uint64_t> persistent(persistentSeed);
+    bench::report(bench::run("persistent publish" + suffix, updates, [&] {
+        for (std::size_t u = 0; u < updates; u++) {
+            persistent.store(persistent.load().pop_front().push_front(u));
+        }
+    }, 3));
+}
+
+static const Table& view(const std::shared_ptr<const Table>& table) { return *table; }
+static const PersistentList<std::uint64_t>& view(const PersistentList<std::uint64_t>& table) { return table; }
+
+// Readers scan the whole table while a writer publishes a new version
+// every `interval`.
+template <typename Load>
+static void readers(const std::string& name, std::size_t reads, unsigned threads, std::chrono::microseconds interval,
+                    Load load, auto publishOne) {
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        for (std::uint64_t u = 0; !done.load(std::memory_order_relaxed); u++) {
+            publishOne(u);
+            std::this_thread::sleep_for(interval);
+        }
+    });
+
+    bench::report(bench::run(name + " threads=" + std::to_string(threads), reads, [&] {
+        std::vector<std::thread> workers;
+        for (unsigned t = 0; t < threads; t++) {
+            workers.emplace_back([&] {
+                std::uint64_t sum = 0;
+                for (std::size_t r = 0; r < reads / threads; r++) {
+                    auto version = load();
+                    const auto& table = view(version);
+                    for (auto it = table.cbegin(); it != table.cend(); ++it) sum += *it;
+                }
+                bench::do_not_optimize(sum);
+            });
+        }
+        for (auto& worker : workers) worker.join();
+    }, 3));
+
+    done = true;
+    writer.join();
+}
+
+int main(int argc, char** argv) {
+    std::size_t reads = bench::size_arg(argc, argv, 20'000);
+    constexpr std::size_t tableSize = 1'000;
+    constexpr auto interval = std::chrono::microseconds(100);
+
+    for (std::size_t n : {1'000, 10'000, 100'000}) publish(n, 200);
+
+    Table seed;
+    PersistentList<std::uint64_t> persistentSeed;
+    for (std::size_t i = 0; i < tableSize; i++) {
+        seed.push_back(i);
+        persistentSeed = persistentSeed.push_front(i);
+    }
+
+    for (unsigned threads : {1u, 2u, 4u}) {
+        std::atomic<std::shared_ptr<const Table>> copied(std::make_shared<const Table>(seed));
+        readers("copy-on-publish readers", reads, threads, interval,
+            [&] { return copied.load(); },
+            [&](std::uint64_t u) {
+                auto next = std::make_shared<Table>(*copied.load());
+                next->pop_front();
+                next->push_front(u);
+                copied.store(std::move(next));
+            });
+
+        AtomicPersistentList<std::uint64_t> persistent(persistentSeed);
+        readers("persistent readers", reads, threads, interval,
+            [&] { return persistent.load(); },
+            [&](std::uint64_t u) { persistent.store(persistent.load().pop_front().push_front(u)); });
+    }
+}
@@ -0,0 +1,137 @@
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "priority_queue.hpp"
+
+// Usage: priority_queue_bench [largest queue size]; pass 100000000 for the
+// 100M-element run, which needs about 1.6 GB.
+
+using Key = std::uint64_t;
+
+// Dijkstra-like mix on a queue holding n keys: every step pops the minimum
+// and pushes one or two keys slightly above it, so the queue drifts upward
+// the way tentative distances do.
+template <class Queue>
+void dijkstraMix(const std::string& name, const std::vector<Key>& seed, std::size_t steps) {
+    bench::report(bench::run(name, steps * 2, [&] {
+        Queue queue(seed.begin(), seed.end());
+        std::uint64_t state = 12345;
+        Key sum = 0;
+        for (std::size_t i = 0; i < steps; i++) {
+            Key top = queue.top();
+            queue.pop();
+            sum += top;
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            queue.push(top + (state >> 54));
+            if (state & 1) {
+                queue.push(top + (state >> 50));
+                queue.pop();
+            }
+        }
+        bench::do_not_optimize(sum);
+    }, 3));
+}
+
+// std::priority_queue's pop() returns void; this gives PriorityQueue the
+// same interface so dijkstraMix serves both.
+template <std::size_t D>
+struct DaryQueue : PriorityQueue<Key, std::greater<Key>, D> {
+    using PriorityQueue<Key, std::greater<Key>, D>::PriorityQueue;
+    void pop() { PriorityQueue<Key, std::greater<Key>, D>::pop(); }
+};
+
+using StdQueue = std::priority_queue<Key, std::vector<Key>, std::greater<Key>>;
+
+struct Graph {
+    std::vector<std::size_t> offsets;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> edges;
+};
+
+Graph randomGraph(std::size_t nodes, std::size_t degree) {
+    Graph graph;
+    std::mt19937_64 rng(7);
+    graph.offsets.push_back(0);
+    for (std::size_t u = 0; u < nodes; u++) {
+        for (std::size_t e = 0; e < degree; e++) {
+            graph.edges.push_back({static_cast<std::uint32_t>(rng() % nodes), static_cast<std::uint32_t>(1 + rng() % 1000)});
+        }
+        graph.offsets.push_back(graph.edges.size());
+    }
+    return graph;
+}
+
+int main(int argc, char** argv) {
+    std::size_t maxSize = bench::size_arg(argc, argv, 10'000'000);
+
+    for (std::size_t n = 1000; n <= maxSize; n *= 10) {
+        std::vector<Key> seed(n);
+        std::mt19937_64 rng(n);
+        for (Key& key : seed) key = rng() % (n * 64);
+        std::size_t steps = std::max<std::size_t>(n, 1'000'000);
+        std::string size = " n=" + std::to_string(n);
+
+        dijkstraMix<StdQueue>("std::priority_queue" + size, seed, steps);
+        dijkstraMix<DaryQueue<2>>("PriorityQueue<D=2>" + size, seed, steps);
+        dijkstraMix<DaryQueue<4>>("PriorityQueue<D=4>" + size, seed, steps);
+        dijkstraMix<DaryQueue<8>>("PriorityQueue<D=8>" + size, seed, steps);
+    }
+
+    // Full Dijkstra: lazy deletion with std::priority_queue against
+    // decrease_key through handles.
+    std::size_t nodes = std::min<std::size_t>(maxSize, 1'000'000);
+    Graph graph = randomGraph(nodes, 4);
+    constexpr std::uint64_t unreached = std::numeric_limits<std::uint64_t>::max();
+    using Entry = std::pair<std::uint64_t, std::uint32_t>;
+
+    bench::report(bench::run("Dijkstra std::priority_queue, lazy deletion", graph.edges.size(), [&] {
+        std::vector<std::uint64_t> dist(nodes, unreached);
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+        dist[0] = 0;
+        queue.push({0, 0});
+        while (!queue.empty()) {
+            auto [d, u] = queue.top();
+            queue.pop();
+            if (d != dist[u]) continue;
+            for (std::size_t e = graph.offsets[u]; e < graph.offsets[u + 1]; e++) {
+                auto [v, w] = graph.edges[e];
+                if (d + w < dist[v]) {
+                    dist[v] = d + w;
+                    queue.push({dist[v], v});
+                }
+            }
+        }
+        bench::do_not_optimize(dist.data());
+    }, 3));
+
+    bench::report(bench::run("Dijkstra PriorityQueue<D=4>, decrease_key", graph.edges.size(), [&] {
+        using Queue = PriorityQueue<Entry, std::greater<Entry>, 4>;
+        std::vector<std::uint64_t> dist(nodes, unreached);
+        std::vector<Queue::Handle> handles(nodes);
+        std::vector<bool> queued(nodes, false);
+        Queue queue;
+        dist[0] = 0;
+        handles[0] = queue.push_handle({0, 0});
+        while (!queue.empty()) {
+            auto [d, u] = queue.pop();
+            for (std::size_t e = graph.offsets[u]; e < graph.offsets[u + 1]; e++) {
+                auto [v, w] = graph.edges[e];
+                if (d + w >= dist[v]) continue;
+                dist[v] = d + w;
+                if (queued[v]) {
+                    queue.decrease_key(handles[v], {dist[v], v});
+                } else {
+                    handles[v] = queue.push_handle({dist[v], v});
+                    queued[v] = true;
+                }
+            }
+        }
+        bench::do_not_optimize(dist.data());
+    }, 3));
+}
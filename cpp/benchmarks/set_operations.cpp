@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "list.hpp"
+
+using List = SinglyLinkedList<std::uint64_t>;
+
+static std::vector<std::uint64_t> sortedIds(std::mt19937_64& rng, std::size_t n, std::uint64_t range) {
+    std::vector<std::uint64_t> ids(n);
+    for (auto& id : ids) id = rng() % range;
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    return ids;
+}
+
+static List listOf(const std::vector<std::uint64_t>& ids) {
+    List list;
+    for (auto id : ids) list.push_back(id);
+    list.compact();
+    return list;
+}
+
+static std::vector<std::uint64_t> toVector(const List& list) {
+    std::vector<std::uint64_t> out;
+    out.reserve(list.size());
+    for (auto it = list.cbegin(); it != list.cend(); ++it) out.push_back(*it);
+    return out;
+}
+
+// Both sides are compacted, so galloping can search them. Half of the small
+// side is sampled from the large one, so includes() has to look at it all
+// on the subset and the intersection is not empty.
+static void ratio(std::size_t n, std::size_t r) {
+    std::mt19937_64 rng(r);
+    auto largeIds = sortedIds(rng, n, n * 4);
+    auto smallIds = sortedIds(rng, std::max<std::size_t>(1, n / r / 2), n * 4);
+    for (std::size_t i = 0; i < largeIds.size(); i += 2 * r) smallIds.push_back(largeIds[i]);
+    std::sort(smallIds.begin(), smallIds.end());
+    smallIds.erase(std::unique(smallIds.begin(), smallIds.end()), smallIds.end());
+
+    std::vector<std::uint64_t> subsetIds;
+    for (std::size_t i = 0; i < largeIds.size(); i += r) subsetIds.push_back(largeIds[i]);
+
+    List large = listOf(largeIds);
+    List small = listOf(smallIds);
+    List subset = listOf(subsetIds);
+    std::size_t ops = large.size() + small.size();
+    std::string suffix = " 1:" + std::to_string(r);
+
+    bench::report(bench::run("vector copy intersection" + suffix, ops, [&] {
+        auto a = toVector(large);
+        auto b = toVector(small);
+        std::vector<std::uint64_t> out;
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out));
+        bench::do_not_optimize(out.data());
+    }, 3));
+
+    for (SetMode mode : {SetMode::linear, SetMode::galloping}) {
+        std::string name = mode == SetMode::linear ? " linear" : " galloping";
+
+        bench::report(bench::run("set_intersection" + name + suffix, ops, [&] {
+            bench::do_not_optimize(small.set_intersection(large, mode).size());
+        }, 3));
+
+        bench::report(bench::run("includes" + name + suffix, ops, [&] {
+            bench::do_not_optimize(large.includes(subset, mode));
+        }, 3));
+
+        // Destroys its inputs, so each run needs fresh copies
+        List target = listOf(largeIds);
+        List source = listOf(smallIds);
+        bench::report(bench::run("set_union_in_place" + name + suffix, ops, [&] {
+            target.set_union_in_place(source, mode);
+        }, 1));
+    }
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = bench::size_arg(argc, argv, 1'000'000);
+
+    for (std::size_t r : {1, 10, 100, 1000, 10000}) ratio(n, r);
+}
@@ -0,0 +1,34 @@
+#include <cstdint>
+#include <cstdio>
+#include <random>
+
+#include "benchmark.hpp"
+#include "list.hpp"
+
+static bench::Result traverse(const char* name, const SinglyLinkedList<std::uint64_t>& list) {
+    return bench::run(name, list.size(), [&] {
+        std::uint64_t sum = 0;
+        for (auto it = list.cbegin(); it != list.cend(); ++it) sum += *it;
+        bench::do_not_optimize(sum);
+    });
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = bench::size_arg(argc, argv, 10'000'000);
+
+    std::mt19937_64 rng(42);
+    SinglyLinkedList<std::uint64_t> list;
+    for (std::size_t i = 0; i < n; i++) list.push_back(rng());
+
+    std::printf("fresh     fragmentation %.3f\n", list.fragmentation());
+    bench::report(traverse("traverse fresh", list));
+
+    list.sort();
+    std::printf("sorted    fragmentation %.3f\n", list.fragmentation());
+    bench::report(traverse("traverse after sort", list));
+
+    auto compaction = bench::run("compact", n, [&] { list.compact(); }, 1);
+    std::printf("compacted fragmentation %.3f\n", list.fragmentation());
+    bench::report(compaction);
+    bench::report(traverse("traverse after compact", list));
+}
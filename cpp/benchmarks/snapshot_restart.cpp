@@ -0,0 +1,67 @@
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+#include "benchmark.hpp"
+#include "list.hpp"
+#include "snapshot.hpp"
+#include "stack.hpp"
+
+// Restart cost of a snapshot of `gigabytes` of uint64_t payload: the old
+// element-by-element restore against bulk load and a zero-copy mapped view.
+static void restart(std::size_t gigabytes) {
+    std::size_t n = (gigabytes << 30) / sizeof(std::uint64_t);
+    std::string path = (std::filesystem::temp_directory_path() / "dsa_restart_bench.bin").string();
+    std::string tag = std::to_string(gigabytes) + " GB ";
+
+    {
+        Stack<std::uint64_t> stack;
+        for (std::size_t i = 0; i < n; i++) stack.push(i);
+        bench::report(bench::run(tag + "Stack::save", n, [&] { stack.save(path); }, 1));
+    }
+
+    bench::report(bench::run(tag + "list restore via push_back", n, [&] {
+        SnapshotReader<std::uint64_t> reader(path);
+        SinglyLinkedList<std::uint64_t> list;
+        std::uint64_t value;
+        for (std::size_t i = 0; i < reader.count(); i++) {
+            reader.read(&value, 1);
+            list.push_back(value);
+        }
+        bench::do_not_optimize(list.back());
+    }, 1));
+
+    bench::report(bench::run(tag + "SinglyLinkedList::load", n, [&] {
+        auto list = SinglyLinkedList<std::uint64_t>::load(path);
+        bench::do_not_optimize(list.back());
+    }, 1));
+
+    bench::report(bench::run(tag + "Stack::load", n, [&] {
+        auto stack = Stack<std::uint64_t>::load(path);
+        bench::do_not_optimize(stack.top());
+    }, 1));
+
+    bench::report(bench::run(tag + "SnapshotView open", 1, [&] {
+        SnapshotView<std::uint64_t> view(path);
+        bench::do_not_optimize(view.size());
+    }, 1));
+
+    bench::report(bench::run(tag + "SnapshotView open + scan", n, [&] {
+        SnapshotView<std::uint64_t> view(path);
+        std::uint64_t sum = 0;
+        for (auto value : view) sum += value;
+        bench::do_not_optimize(sum);
+    }, 1));
+
+    std::filesystem::remove(path);
+}
+
+int main(int argc, char** argv) {
+    std::size_t maxGigabytes = bench::size_arg(argc, argv, 1);
+
+    for (std::size_t gigabytes : {1, 2, 5, 10}) {
+        if (gigabytes > maxGigabytes) break;
+        restart(gigabytes);
+    }
+}
@@ -0,0 +1,67 @@
+#include <cstdint>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "soa_stack.hpp"
+#include "stack.hpp"
+
+struct Record {
+    double value;
+    std::uint32_t tag;
+    std::uint8_t flags;
+};
+
+int main(int argc, char** argv) {
+    std::size_t n = bench::size_arg(argc, argv, 10'000'000);
+
+    Stack<Record> aos;
+    SoaStack<double, std::uint32_t, std::uint8_t> soa;
+    for (std::size_t i = 0; i < n; i++) {
+        aos.push({i * 0.5, static_cast<std::uint32_t>(i), static_cast<std::uint8_t>(i)});
+        soa.push(i * 0.5, static_cast<std::uint32_t>(i), static_cast<std::uint8_t>(i));
+    }
+
+    // The evaluator's hot loop: read only the value field
+    auto aosScan = bench::run("Stack<Record> value scan", n, [&] {
+        const Record* records = aos.data();
+        double sum = 0;
+        for (std::size_t i = 0; i < n; i++) sum += records[i].value;
+        bench::do_not_optimize(sum);
+    });
+    aosScan.bytes = n * sizeof(Record);
+    bench::report(aosScan);
+
+    auto soaScan = bench::run("SoaStack value column scan", n, [&] {
+        double sum = 0;
+        for (double v : soa.column<0>()) sum += v;
+        bench::do_not_optimize(sum);
+    });
+    soaScan.bytes = n * sizeof(double);
+    bench::report(soaScan);
+
+    bench::report(bench::run("Stack<Record> push/pop", n * 2, [&] {
+        Stack<Record> stack;
+        for (std::size_t i = 0; i < n; i++) stack.push({double(i), static_cast<std::uint32_t>(i), 0});
+        double sum = 0;
+        while (!stack.empty()) sum += stack.pop().value;
+        bench::do_not_optimize(sum);
+    }, 3));
+
+    bench::report(bench::run("SoaStack push/pop", n * 2, [&] {
+        SoaStack<double, std::uint32_t, std::uint8_t> stack;
+        for (std::size_t i = 0; i < n; i++) stack.push(double(i), static_cast<std::uint32_t>(i), 0);
+        double sum = 0;
+        while (!stack.empty()) sum += std::get<0>(stack.pop());
+        bench::do_not_optimize(sum);
+    }, 3));
+
+    std::vector<double> values(n);
+    std::vector<std::uint32_t> tags(n);
+    std::vector<std::uint8_t> flags(n);
+    bench::report(bench::run("SoaStack push_range/pop_into", n * 2, [&] {
+        SoaStack<double, std::uint32_t, std::uint8_t> stack;
+        stack.push_range(values, tags, flags);
+        stack.pop_into(values, tags, flags);
+        bench::do_not_optimize(values.data());
+    }, 3));
+}
@@ -0,0 +1,48 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "stack.hpp"
+
+struct Token {
+    std::uint32_t kind;
+    std::uint32_t offset;
+    std::uint64_t value;
+};
+
+// Moves `total` tokens through a stack in batches: push a batch, pop it back
+// out into a buffer, one element at a time or with the bulk calls.
+int main(int argc, char** argv) {
+    std::size_t total = bench::size_arg(argc, argv, 10'000'000);
+
+    for (std::size_t batch : {16, 256, 4096, 65536}) {
+        std::vector<Token> tokens(batch);
+        for (std::size_t i = 0; i < batch; i++) tokens[i] = {static_cast<std::uint32_t>(i), 0, i};
+        std::vector<Token> out(batch);
+        std::size_t rounds = total / batch;
+        std::string suffix = " batch=" + std::to_string(batch);
+
+        auto perElement = bench::run("per-element push/pop" + suffix, rounds * batch * 2, [&] {
+            Stack<Token> stack;
+            for (std::size_t r = 0; r < rounds; r++) {
+                for (const Token& token : tokens) stack.push(token);
+                for (std::size_t i = batch; i-- > 0;) out[i] = stack.pop();
+            }
+            bench::do_not_optimize(out.data());
+        });
+        perElement.bytes = rounds * batch * 2 * sizeof(Token);
+        bench::report(perElement);
+
+        auto bulk = bench::run("push_range/pop_into" + suffix, rounds * batch * 2, [&] {
+            Stack<Token> stack;
+            for (std::size_t r = 0; r < rounds; r++) {
+                stack.push_range(tokens);
+                stack.pop_into(out);
+            }
+            bench::do_not_optimize(out.data());
+        });
+        bulk.bytes = rounds * batch * 2 * sizeof(Token);
+        bench::report(bulk);
+    }
+}
@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "benchmark.hpp"
+#include "cow_stack.hpp"
+#include "stack.hpp"
+
+// The owner runs a push/pop walk around a deep stack while a monitor thread
+// takes a view of it `hz` times a second, under the lock the owner holds
+// for each batch: a deep copy of Stack, or an O(1) CowStack snapshot. Either
+// view is then summed outside the lock. Besides owner throughput, reports
+// how long the monitor kept the owner locked out per view.
+template <class Container, class Capture, class Read>
+void ownerWithMonitor(const std::string& name, std::size_t depth, std::size_t ops, int hz, Capture capture, Read read) {
+    std::chrono::duration<double> held{};
+    std::chrono::duration<double> longest{};
+    std::size_t views = 0;
+
+    bench::report(bench::run(name, ops, [&] {
+        Container stack;
+        for (std::size_t i = 0; i < depth; i++) stack.push(i);
+
+        std::mutex mutex;
+        std::mutex doneMutex;
+        std::condition_variable doneSignal;
+        bool done = false;
+        std::thread monitor([&] {
+            if (hz == 0) return;
+            auto period = std::chrono::microseconds(1'000'000 / hz);
+            auto next = std::chrono::steady_clock::now();
+            while (true) {
+                next += period;
+                {
+                    std::unique_lock lock(doneMutex);
+                    if (doneSignal.wait_until(lock, next, [&] { return done; })) return;
+                }
+
+                std::unique_lock lock(mutex);
+                auto start = std::chrono::steady_clock::now();
+                auto view = capture(stack);
+                std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+                lock.unlock();
+
+                held += elapsed;
+                longest = std::max(longest, elapsed);
+                views++;
+                bench::do_not_optimize(read(view));
+            }
+        });
+
+        constexpr std::size_t batch = 1024;
+        std::uint64_t state = 1;
+        for (std::size_t i = 0; i < ops; i += batch) {
+            std::lock_guard lock(mutex);
+            for (std::size_t j = 0; j < batch; j++) {
+                state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+                if (state >> 63) {
+                    stack.push(state);
+                } else {
+                    bench::do_not_optimize(stack.pop());
+                }
+            }
+        }
+        {
+            std::lock_guard lock(doneMutex);
+            done = true;
+        }
+        doneSignal.notify_one();
+        monitor.join();
+    }, 3));
+
+    if (views > 0) {
+        std::printf("    %zu views, lock held %.2f us on average, %.2f us at most\n",
+                    views, held.count() * 1e6 / static_cast<double>(views), longest.count() * 1e6);
+    }
+}
+
+int main(int argc, char** argv) {
+    std::size_t depth = bench::size_arg(argc, argv, 1'000'000);
+    std::size_t ops = 200'000'000;
+
+    for (int hz : {0, 1, 10, 100, 1000}) {
+        std::string suffix = " depth=" + std::to_string(depth) + " " + std::to_string(hz) + " Hz";
+
+        ownerWithMonitor<Stack<std::uint64_t>>("Stack deep copy" + suffix, depth, ops, hz,
+            [](const Stack<std::uint64_t>& stack) { return Stack<std::uint64_t>(stack); },
+            [](const Stack<std::uint64_t>& copy) {
+                std::uint64_t sum = 0;
+                for (std::size_t i = 0; i < copy.size(); i++) sum += copy.data()[i];
+                return sum;
+            });
+
+        ownerWithMonitor<CowStack<std::uint64_t>>("CowStack snapshot" + suffix, depth, ops, hz,
+            [](const CowStack<std::uint64_t>& stack) { return stack.snapshot(); },
+            [](const CowStack<std::uint64_t>::Snapshot& snapshot) {
+                std::uint64_t sum = 0;
+                for (std::uint64_t value : snapshot) sum += value;
+                return sum;
+            });
+    }
+}
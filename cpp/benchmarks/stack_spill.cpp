@@ -0,0 +1,54 @@
+#include <cstdint>
+#include <string>
+
+#include "benchmark.hpp"
+#include "spilling_stack.hpp"
+#include "stack.hpp"
+
+// Usage: stack_spill_bench [memory limit in MiB]; every run pushes ten times
+// the limit through the stack.
+int main(int argc, char** argv) {
+    std::size_t limitMiB = bench::size_arg(argc, argv, 16);
+
+    constexpr std::size_t window = 8;
+    constexpr std::size_t segmentSize = SpillingStack<std::uint64_t>::defaultSegmentBytes / sizeof(std::uint64_t);
+    std::size_t segments = limitMiB * (std::size_t(1) << 20) / SpillingStack<std::uint64_t>::defaultSegmentBytes;
+    std::size_t windowSegments = segments > window ? segments : window;
+    std::size_t n = 10 * windowSegments * segmentSize;
+
+    std::string suffix = " (" + std::to_string(n * sizeof(std::uint64_t) >> 20) + " MiB, limit " + std::to_string(limitMiB) + " MiB)";
+
+    bench::report(bench::run("Stack push/pop" + suffix, n * 2, [&] {
+        Stack<std::uint64_t> stack;
+        for (std::size_t i = 0; i < n; i++) stack.push(i);
+        std::uint64_t sum = 0;
+        while (!stack.empty()) sum += stack.pop();
+        bench::do_not_optimize(sum);
+    }, 3));
+
+    auto pushPop = bench::run("SpillingStack push/pop" + suffix, n * 2, [&] {
+        SpillingStack<std::uint64_t> stack(segmentSize, windowSegments);
+        for (std::size_t i = 0; i < n; i++) stack.push(i);
+        std::uint64_t sum = 0;
+        while (!stack.empty()) sum += stack.pop();
+        bench::do_not_optimize(sum);
+    }, 3);
+    pushPop.bytes = 2 * n * sizeof(std::uint64_t);
+    bench::report(pushPop);
+
+    // Backtracking shape: three pushes for every two pops on the way down
+    // the search tree, then unwinding to the root.
+    bench::report(bench::run("SpillingStack backtracking" + suffix, n * 3, [&] {
+        SpillingStack<std::uint64_t> stack(segmentSize, windowSegments);
+        std::uint64_t sum = 0;
+        for (std::size_t depth = 0; depth < n / 2; depth++) {
+            stack.push(depth);
+            stack.push(depth + 1);
+            stack.push(depth + 2);
+            sum += stack.pop();
+            sum += stack.pop();
+        }
+        while (!stack.empty()) sum += stack.pop();
+        bench::do_not_optimize(sum);
+    }, 3));
+}
@@ -0,0 +1,42 @@
+#include <cstdint>
+#include <string>
+
+#include "benchmark.hpp"
+#include "stack.hpp"
+#include "static_stack.hpp"
+
+// Fill-and-drain cycles on a fresh stack each round, the shape of a small
+// scratch stack inside a hot function.
+template <std::size_t N>
+static void cycles(std::size_t rounds) {
+    std::string suffix = " N=" + std::to_string(N);
+
+    bench::report(bench::run("Stack<int>" + suffix, rounds * N * 2, [&] {
+        std::uint64_t sum = 0;
+        for (std::size_t r = 0; r < rounds; r++) {
+            Stack<int> stack;
+            for (std::size_t i = 0; i < N; i++) stack.push(static_cast<int>(i + r));
+            while (!stack.empty()) sum += stack.pop();
+        }
+        bench::do_not_optimize(sum);
+    }));
+
+    bench::report(bench::run("StaticStack<int, N>" + suffix, rounds * N * 2, [&] {
+        std::uint64_t sum = 0;
+        for (std::size_t r = 0; r < rounds; r++) {
+            StaticStack<int, N> stack;
+            for (std::size_t i = 0; i < N; i++) stack.push(static_cast<int>(i + r));
+            while (!stack.empty()) sum += stack.pop();
+        }
+        bench::do_not_optimize(sum);
+    }));
+}
+
+int main(int argc, char** argv) {
+    std::size_t rounds = bench::size_arg(argc, argv, 200'000);
+
+    cycles<4>(rounds);
+    cycles<16>(rounds);
+    cycles<64>(rounds);
+    cycles<256>(rounds);
+}
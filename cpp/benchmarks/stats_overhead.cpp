@@ -0,0 +1,57 @@
+#include <cstdint>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "list.hpp"
+#include "stack.hpp"
+
+// Stack<T> with the default NoStats policy should run at the same speed as
+// the bare std::vector it wraps; the counting and latency policies show the
+// price of turning instrumentation on.
+
+template <typename Stats>
+static void stackPushPop(const char* name, std::size_t n) {
+    bench::report(bench::run(name, 2 * n, [&] {
+        Stack<std::uint64_t, Stats> stack;
+        for (std::size_t i = 0; i < n; i++) stack.push(i);
+        std::uint64_t sum = 0;
+        while (!stack.empty()) sum += stack.pop();
+        bench::do_not_optimize(sum);
+    }));
+}
+
+template <typename Stats>
+static void listAt(const char* name, std::size_t n) {
+    SinglyLinkedList<std::uint64_t, Stats> list;
+    for (std::size_t i = 0; i < n; i++) list.push_back(i);
+
+    std::size_t lookups = 1000;
+    bench::report(bench::run(name, lookups, [&] {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < lookups; i++) sum += list.at((i * 7919) % n);
+        bench::do_not_optimize(sum);
+    }));
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = bench::size_arg(argc, argv, 10'000'000);
+
+    bench::report(bench::run("std::vector push/pop", 2 * n, [&] {
+        std::vector<std::uint64_t> vector;
+        for (std::size_t i = 0; i < n; i++) vector.push_back(i);
+        std::uint64_t sum = 0;
+        while (!vector.empty()) {
+            sum += vector.back();
+            vector.pop_back();
+        }
+        bench::do_not_optimize(sum);
+    }));
+    stackPushPop<NoStats>("Stack<NoStats> push/pop", n);
+    stackPushPop<CountingStats>("Stack<CountingStats> push/pop", n);
+    stackPushPop<LatencyStats>("Stack<LatencyStats> push/pop", n);
+
+    std::size_t listSize = n / 100;
+    listAt<NoStats>("SinglyLinkedList<NoStats> at", listSize);
+    listAt<CountingStats>("SinglyLinkedList<CountingStats> at", listSize);
+    listAt<LatencyStats>("SinglyLinkedList<LatencyStats> at", listSize);
+}
@@ -0,0 +1,65 @@
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "stream.hpp"
+
+template <typename Codec, typename T>
+static void roundTrip(const std::string& name, const SinglyLinkedList<T>& list, std::size_t payloadBytes, bool background) {
+    StreamOptions options;
+    options.background = background;
+
+    std::vector<std::byte> bytes;
+    bytes.reserve(payloadBytes + payloadBytes / 8);
+
+    auto written = bench::run(name + " serialize", list.size(), [&] {
+        bytes.clear();
+        BufferSink sink(bytes);
+        serialize<Codec>(list, sink, options);
+    }, 3);
+    written.bytes = payloadBytes;
+    bench::report(written);
+
+    auto read = bench::run(name + " deserialize", list.size(), [&] {
+        BufferSource source(bytes);
+        SinglyLinkedList<T> copy;
+        deserialize<Codec>(source, copy, options);
+        bench::do_not_optimize(copy.size());
+    }, 3);
+    read.bytes = payloadBytes;
+    bench::report(read);
+
+    std::printf("%-48s %12.3f\n", (name + " ratio").c_str(), static_cast<double>(bytes.size()) / static_cast<double>(payloadBytes));
+}
+
+template <typename T>
+static void suite(const std::string& name, const SinglyLinkedList<T>& list, std::size_t payloadBytes) {
+    roundTrip<NullCodec>(name + " raw", list, payloadBytes, false);
+    roundTrip<NullCodec>(name + " raw bg", list, payloadBytes, true);
+    roundTrip<Lz4Codec>(name + " lz4", list, payloadBytes, false);
+    roundTrip<Lz4Codec>(name + " lz4 bg", list, payloadBytes, true);
+}
+
+int main(int argc, char** argv) {
+    std::size_t n = bench::size_arg(argc, argv, 2'000'000);
+    std::mt19937_64 rng(42);
+
+    // Small ids with a skewed distribution, the common shape of int64 payloads.
+    SinglyLinkedList<std::int64_t> ints;
+    std::geometric_distribution<std::int64_t> ids(0.001);
+    for (std::size_t i = 0; i < n; i++) ints.push_back(ids(rng));
+    suite("int64", ints, n * sizeof(std::int64_t));
+
+    static const char* words[] = {"alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel"};
+    SinglyLinkedList<std::string> strings;
+    std::size_t stringBytes = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        std::string value = std::string(words[rng() % 8]) + "-" + std::to_string(rng() % 100000);
+        stringBytes += value.size();
+        strings.push_back(value);
+    }
+    suite("string", strings, stringBytes);
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+// Double-ended queue built from fixed-size blocks. A compact map holds one
+// pointer per block, so element i is found with a shift and a mask, and
+// pushing at either end never moves existing elements: references stay
+// valid until their element is popped. Blocks emptied at either end are
+// kept for reuse instead of being freed.
+template <typename T>
+class ChunkedDeque {
+public:
+    static constexpr std::size_t defaultBlockSize = std::bit_floor(std::max<std::size_t>(16, 4096 / sizeof(T)));
+    static constexpr std::size_t maxSpareBlocks = 4;
+private:
+    // Live blocks are map_[mapBegin_, mapEnd_); the elements occupy slots
+    // [first_, first_ + size_) counted from the start of the first one.
+    std::vector<T*> map_;
+    std::size_t mapBegin_ = 0;
+    std::size_t mapEnd_ = 0;
+    std::size_t first_ = 0;
+    std::size_t size_ = 0;
+
+    std::size_t blockSize_;
+    std::size_t shift_;
+    std::size_t mask_;
+
+    std::vector<T*> spare_;
+
+    T* slot(std::size_t pos) const noexcept;
+    std::size_t blocks() const noexcept;
+
+    // Block helpers
+    T* acquireBlock();
+    void recycleBlock(T* block) noexcept;
+    void freeBlock(T* block) noexcept;
+    void makeMapRoom(bool front);
+    void appendBlock();
+    void prependBlock();
+    void resetEmpty() noexcept;
+public:
+    template <bool Const>
+    class basic_iterator {
+    private:
+        using Deque = std::conditional_t<Const, const ChunkedDeque, ChunkedDeque>;
+
+        Deque* deque_ = nullptr;
+        std::ptrdiff_t pos_ = 0;
+        friend class ChunkedDeque;
+        template <bool> friend class basic_iterator;
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() = default;
+        basic_iterator(Deque* deque, std::ptrdiff_t pos) noexcept : deque_(deque), pos_(pos) {}
+        template <bool OtherConst>
+            requires (Const && !OtherConst)
+        basic_iterator(const basic_iterator<OtherConst>& it) noexcept : deque_(it.deque_), pos_(it.pos_) {}
+
+        reference operator*() const { return *deque_->slot(static_cast<std::size_t>(pos_)); }
+        pointer operator->() const { return deque_->slot(static_cast<std::size_t>(pos_)); }
+        reference operator[](difference_type n) const { return *deque_->slot(static_cast<std::size_t>(pos_ + n)); }
+
+        basic_iterator& operator++() { ++pos_; return *this; }
+        basic_iterator operator++(int) { basic_iterator tmp(*this); ++pos_; return tmp; }
+        basic_iterator& operator--() { --pos_; return *this; }
+        basic_iterator operator--(int) { basic_iterator tmp(*this); --pos_; return tmp; }
+
+        basic_iterator& operator+=(difference_type n) { pos_ += n; return *this; }
+        basic_iterator& operator-=(difference_type n) { pos_ -= n; return *this; }
+
+        friend basic_iterator operator+(basic_iterator it, difference_type n) { return it += n; }
+        friend basic_iterator operator+(difference_type n, basic_iterator it) { return it += n; }
+        friend basic_iterator operator-(basic_iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const basic_iterator& a, const basic_iterator& b) { return a.pos_ - b.pos_; }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) { return a.pos_ == b.pos_; }
+        friend auto operator<=>(const basic_iterator& a, const basic_iterator& b) { return a.pos_ <=> b.pos_; }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    // blockSize is rounded up to a power of two
+    explicit ChunkedDeque(std::size_t blockSize = defaultBlockSize);
+    ChunkedDeque(const ChunkedDeque& other);
+    ChunkedDeque(ChunkedDeque&& other) noexcept;
+
+    ~ChunkedDeque() noexcept;
+
+    ChunkedDeque& operator=(ChunkedDeque other) noexcept;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator cend() const noexcept;
+
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+    std::size_t block_size() const noexcept;
+    std::size_t spare_blocks() const noexcept;
+
+    T& front();
+    const T& front() const;
+    T& back();
+    const T& back() const;
+
+    T& at(std::size_t pos);
+    const T& at(std::size_t pos) const;
+    T& operator[](std::size_t pos) noexcept;
+    const T& operator[](std::size_t pos) const noexcept;
+
+    void push_back(const T& value);
+    void push_back(T&& value);
+    void push_front(const T& value);
+    void push_front(T&& value);
+
+    template <class... Args>
+    T& emplace_back(Args&&... args);
+    template <class... Args>
+    T& emplace_front(Args&&... args);
+
+    T pop_back();
+    T pop_front();
+
+    void clear() noexcept;
+
+    // Frees the spare blocks and trims the block map
+    void shrink_to_fit();
+
+    bool operator==(const ChunkedDeque& other) const;
+    bool operator!=(const ChunkedDeque& other) const;
+
+    void swap(ChunkedDeque& other) noexcept;
+};
+
+template <typename T>
+void swap(ChunkedDeque<T>& a, ChunkedDeque<T>& b) noexcept;
+
+#include "chunked_deque.inl"
@@ -0,0 +1,398 @@
+#include "chunked_deque.hpp"
+
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+// ### Constructors ###
+
+template <typename T>
+ChunkedDeque<T>::ChunkedDeque(std::size_t blockSize) {
+    if (blockSize == 0) throw std::invalid_argument("block size must be positive");
+
+    blockSize_ = std::bit_ceil(blockSize);
+    shift_ = static_cast<std::size_t>(std::countr_zero(blockSize_));
+    mask_ = blockSize_ - 1;
+    spare_.reserve(maxSpareBlocks);
+}
+
+template <typename T>
+ChunkedDeque<T>::ChunkedDeque(const ChunkedDeque& other) : ChunkedDeque(other.blockSize_) {
+    for (const T& value : other) push_back(value);
+}
+
+template <typename T>
+ChunkedDeque<T>::ChunkedDeque(ChunkedDeque&& other) noexcept
+    : map_(std::move(other.map_)),
+      mapBegin_(std::exchange(other.mapBegin_, 0)),
+      mapEnd_(std::exchange(other.mapEnd_, 0)),
+      first_(std::exchange(other.first_, 0)),
+      size_(std::exchange(other.size_, 0)),
+      blockSize_(other.blockSize_),
+      shift_(other.shift_),
+      mask_(other.mask_),
+      spare_(std::move(other.spare_)) {
+    other.map_.clear();
+    other.spare_.clear();
+}
+
+// ### Destructor ###
+
+template <typename T>
+ChunkedDeque<T>::~ChunkedDeque() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (std::size_t i = 0; i < size_; i++) std::destroy_at(slot(i));
+    }
+    for (std::size_t b = mapBegin_; b < mapEnd_; b++) freeBlock(map_[b]);
+    for (T* block : spare_) freeBlock(block);
+}
+
+// ### Operators ###
+
+template <typename T>
+ChunkedDeque<T>& ChunkedDeque<T>::operator=(ChunkedDeque other) noexcept {
+    swap(other);
+    return *this;
+}
+
+template <typename T>
+bool ChunkedDeque<T>::operator==(const ChunkedDeque& other) const {
+    return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+}
+
+template <typename T>
+bool ChunkedDeque<T>::operator!=(const ChunkedDeque& other) const {
+    return !(*this == other);
+}
+
+// ### Iterators ###
+
+template <typename T>
+ChunkedDeque<T>::iterator ChunkedDeque<T>::begin() noexcept {
+    return iterator(this, 0);
+}
+
+template <typename T>
+ChunkedDeque<T>::iterator ChunkedDeque<T>::end() noexcept {
+    return iterator(this, static_cast<std::ptrdiff_t>(size_));
+}
+
+template <typename T>
+ChunkedDeque<T>::const_iterator ChunkedDeque<T>::begin() const noexcept {
+    return const_iterator(this, 0);
+}
+
+template <typename T>
+ChunkedDeque<T>::const_iterator ChunkedDeque<T>::end() const noexcept {
+    return const_iterator(this, static_cast<std::ptrdiff_t>(size_));
+}
+
+template <typename T>
+ChunkedDeque<T>::const_iterator ChunkedDeque<T>::cbegin() const noexcept {
+    return begin();
+}
+
+template <typename T>
+ChunkedDeque<T>::const_iterator ChunkedDeque<T>::cend() const noexcept {
+    return end();
+}
+
+// ### Capacity methods ###
+
+template <typename T>
+std::size_t ChunkedDeque<T>::size() const noexcept {
+    return size_;
+}
+
+template <typename T>
+bool ChunkedDeque<T>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename T>
+std::size_t ChunkedDeque<T>::block_size() const noexcept {
+    return blockSize_;
+}
+
+template <typename T>
+std::size_t ChunkedDeque<T>::spare_blocks() const noexcept {
+    return spare_.size();
+}
+
+// ### Access methods ###
+
+template <typename T>
+T& ChunkedDeque<T>::front() {
+    if (empty()) throw std::out_of_range("front on empty deque");
+    return *slot(0);
+}
+
+template <typename T>
+const T& ChunkedDeque<T>::front() const {
+    if (empty()) throw std::out_of_range("front on empty deque");
+    return *slot(0);
+}
+
+template <typename T>
+T& ChunkedDeque<T>::back() {
+    if (empty()) throw std::out_of_range("back on empty deque");
+    return *slot(size_ - 1);
+}
+
+template <typename T>
+const T& ChunkedDeque<T>::back() const {
+    if (empty()) throw std::out_of_range("back on empty deque");
+    return *slot(size_ - 1);
+}
+
+template <typename T>
+T& ChunkedDeque<T>::at(std::size_t pos) {
+    if (pos >= size_) throw std::out_of_range("at pos out of range");
+    return *slot(pos);
+}
+
+template <typename T>
+const T& ChunkedDeque<T>::at(std::size_t pos) const {
+    if (pos >= size_) throw std::out_of_range("at pos out of range");
+    return *slot(pos);
+}
+
+template <typename T>
+T& ChunkedDeque<T>::operator[](std::size_t pos) noexcept {
+    return *slot(pos);
+}
+
+template <typename T>
+const T& ChunkedDeque<T>::operator[](std::size_t pos) const noexcept {
+    return *slot(pos);
+}
+
+template <typename T>
+T* ChunkedDeque<T>::slot(std::size_t pos) const noexcept {
+    std::size_t index = first_ + pos;
+    return map_[mapBegin_ + (index >> shift_)] + (index & mask_);
+}
+
+// ### Modifier methods ###
+
+template <typename T>
+void ChunkedDeque<T>::push_back(const T& value) {
+    emplace_back(value);
+}
+
+template <typename T>
+void ChunkedDeque<T>::push_back(T&& value) {
+    emplace_back(std::move(value));
+}
+
+template <typename T>
+void ChunkedDeque<T>::push_front(const T& value) {
+    emplace_front(value);
+}
+
+template <typename T>
+void ChunkedDeque<T>::push_front(T&& value) {
+    emplace_front(std::move(value));
+}
+
+template <typename T>
+template <class... Args>
+T& ChunkedDeque<T>::emplace_back(Args&&... args) {
+    std::size_t index = first_ + size_;
+    bool added = (index >> shift_) == blocks();
+    if (added) appendBlock();
+
+    T* target = map_[mapBegin_ + (index >> shift_)] + (index & mask_);
+    try {
+        std::construct_at(target, std::forward<Args>(args)...);
+    } catch (...) {
+        if (added) recycleBlock(map_[--mapEnd_]);
+        throw;
+    }
+    size_++;
+
+    return *target;
+}
+
+template <typename T>
+template <class... Args>
+T& ChunkedDeque<T>::emplace_front(Args&&... args) {
+    bool added = first_ == 0;
+    if (added) {
+        prependBlock();
+        first_ = blockSize_;
+    }
+
+    T* target = map_[mapBegin_] + (first_ - 1);
+    try {
+        std::construct_at(target, std::forward<Args>(args)...);
+    } catch (...) {
+        if (added) {
+            recycleBlock(map_[mapBegin_++]);
+            first_ = 0;
+        }
+        throw;
+    }
+    first_--;
+    size_++;
+
+    return *target;
+}
+
+template <typename T>
+T ChunkedDeque<T>::pop_back() {
+    if (empty()) throw std::out_of_range("pop_back on empty deque");
+
+    T* target = slot(size_ - 1);
+    T value = std::move(*target);
+    std::destroy_at(target);
+    size_--;
+
+    if (size_ == 0) {
+        resetEmpty();
+    } else if (((first_ + size_) & mask_) == 0) {
+        recycleBlock(map_[--mapEnd_]);
+    }
+
+    return value;
+}
+
+template <typename T>
+T ChunkedDeque<T>::pop_front() {
+    if (empty()) throw std::out_of_range("pop_front on empty deque");
+
+    T* target = slot(0);
+    T value = std::move(*target);
+    std::destroy_at(target);
+    first_++;
+    size_--;
+
+    if (size_ == 0) {
+        resetEmpty();
+    } else if (first_ == blockSize_) {
+        recycleBlock(map_[mapBegin_++]);
+        first_ = 0;
+    }
+
+    return value;
+}
+
+template <typename T>
+void ChunkedDeque<T>::clear() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (std::size_t i = 0; i < size_; i++) std::destroy_at(slot(i));
+    }
+    size_ = 0;
+    resetEmpty();
+}
+
+template <typename T>
+void ChunkedDeque<T>::shrink_to_fit() {
+    for (T* block : spare_) freeBlock(block);
+    spare_.clear();
+
+    std::vector<T*> map(map_.begin() + static_cast<std::ptrdiff_t>(mapBegin_), map_.begin() + static_cast<std::ptrdiff_t>(mapEnd_));
+    map_.swap(map);
+    mapEnd_ -= mapBegin_;
+    mapBegin_ = 0;
+}
+
+// ### Block helpers ###
+
+template <typename T>
+std::size_t ChunkedDeque<T>::blocks() const noexcept {
+    return mapEnd_ - mapBegin_;
+}
+
+template <typename T>
+T* ChunkedDeque<T>::acquireBlock() {
+    if (!spare_.empty()) {
+        T* block = spare_.back();
+        spare_.pop_back();
+        return block;
+    }
+    return static_cast<T*>(::operator new(blockSize_ * sizeof(T), std::align_val_t(alignof(T))));
+}
+
+// Only fills capacity spare_ already has, reserved at construction, so
+// this never allocates.
+template <typename T>
+void ChunkedDeque<T>::recycleBlock(T* block) noexcept {
+    if (spare_.size() < std::min(maxSpareBlocks, spare_.capacity())) {
+        spare_.push_back(block);
+    } else {
+        freeBlock(block);
+    }
+}
+
+template <typename T>
+void ChunkedDeque<T>::freeBlock(T* block) noexcept {
+    ::operator delete(block, std::align_val_t(alignof(T)));
+}
+
+// Re-centres the live blocks in the map, doubling it first if they fill
+// more than half, so either end has room to grow.
+template <typename T>
+void ChunkedDeque<T>::makeMapRoom(bool front) {
+    if (front ? mapBegin_ > 0 : mapEnd_ < map_.size()) return;
+
+    std::size_t count = blocks();
+    std::size_t size = map_.size();
+    if (2 * (count + 1) > size) size = std::max<std::size_t>(8, 2 * size);
+
+    std::vector<T*> map(size, nullptr);
+    std::size_t begin = (size - count) / 2;
+    std::copy(map_.begin() + static_cast<std::ptrdiff_t>(mapBegin_), map_.begin() + static_cast<std::ptrdiff_t>(mapEnd_),
+              map.begin() + static_cast<std::ptrdiff_t>(begin));
+
+    map_.swap(map);
+    mapBegin_ = begin;
+    mapEnd_ = begin + count;
+}
+
+template <typename T>
+void ChunkedDeque<T>::appendBlock() {
+    makeMapRoom(false);
+    map_[mapEnd_] = acquireBlock();
+    mapEnd_++;
+}
+
+template <typename T>
+void ChunkedDeque<T>::prependBlock() {
+    makeMapRoom(true);
+    map_[mapBegin_ - 1] = acquireBlock();
+    mapBegin_--;
+}
+
+// Keeps one block with the insertion point in its middle, so a deque that
+// drains and refills, from either end, does not touch the allocator.
+template <typename T>
+void ChunkedDeque<T>::resetEmpty() noexcept {
+    if (blocks() == 0) {
+        first_ = 0;
+        return;
+    }
+    while (blocks() > 1) recycleBlock(map_[--mapEnd_]);
+    first_ = blockSize_ / 2;
+}
+
+// ### Swap methods ###
+
+template <typename T>
+void ChunkedDeque<T>::swap(ChunkedDeque& other) noexcept {
+    map_.swap(other.map_);
+    std::swap(mapBegin_, other.mapBegin_);
+    std::swap(mapEnd_, other.mapEnd_);
+    std::swap(first_, other.first_);
+    std::swap(size_, other.size_);
+    std::swap(blockSize_, other.blockSize_);
+    std::swap(shift_, other.shift_);
+    std::swap(mask_, other.mask_);
+    spare_.swap(other.spare_);
+}
+
+template <typename T>
+void swap(ChunkedDeque<T>& a, ChunkedDeque<T>& b) noexcept {
+    a.swap(b);
+}
@@ -0,0 +1,181 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../chunked_deque.hpp"
+
+static_assert(std::random_access_iterator<ChunkedDeque<int>::iterator>);
+static_assert(std::random_access_iterator<ChunkedDeque<int>::const_iterator>);
+static_assert(std::ranges::random_access_range<ChunkedDeque<int>>);
+
+TEST_CASE("Default construction", "[constructor]") {
+    ChunkedDeque<int> deque;
+
+    REQUIRE(deque.size() == 0);
+    REQUIRE(deque.empty());
+    REQUIRE(deque.block_size() == ChunkedDeque<int>::defaultBlockSize);
+}
+
+TEST_CASE("Block size is rounded up to a power of two", "[constructor]") {
+    REQUIRE(ChunkedDeque<int>(5).block_size() == 8);
+    REQUIRE(ChunkedDeque<int>(1).block_size() == 1);
+    REQUIRE_THROWS_AS(ChunkedDeque<int>(0), std::invalid_argument);
+}
+
+TEST_CASE("Push and pop at both ends", "[modifiers]") {
+    ChunkedDeque<int> deque(4);
+
+    for (int i = 0; i < 10; i++) deque.push_back(i);
+    for (int i = 1; i <= 10; i++) deque.push_front(-i);
+
+    REQUIRE(deque.size() == 20);
+    REQUIRE(deque.front() == -10);
+    REQUIRE(deque.back() == 9);
+
+    for (int i = 0; i < 20; i++) REQUIRE(deque[i] == i - 10);
+
+    REQUIRE(deque.pop_front() == -10);
+    REQUIRE(deque.pop_back() == 9);
+    REQUIRE(deque.size() == 18);
+}
+
+TEST_CASE("Random operations match std::deque", "[modifiers]") {
+    for (std::size_t blockSize : {1u, 2u, 8u, 64u}) {
+        ChunkedDeque<int> deque(blockSize);
+        std::deque<int> reference;
+        std::mt19937 rng(static_cast<unsigned>(blockSize));
+
+        for (int step = 0; step < 20'000; step++) {
+            int op = static_cast<int>(rng() % 4);
+            if (reference.empty() || op == 0) {
+                deque.push_back(step);
+                reference.push_back(step);
+            } else if (op == 1) {
+                deque.push_front(step);
+                reference.push_front(step);
+            } else if (op == 2) {
+                REQUIRE(deque.pop_back() == reference.back());
+                reference.pop_back();
+            } else {
+                REQUIRE(deque.pop_front() == reference.front());
+                reference.pop_front();
+            }
+
+            REQUIRE(deque.size() == reference.size());
+            if (!reference.empty()) {
+                std::size_t pos = rng() % reference.size();
+                REQUIRE(deque[pos] == reference[pos]);
+            }
+        }
+        REQUIRE(std::ranges::equal(deque, reference));
+    }
+}
+
+TEST_CASE("References stay valid when pushing at either end", "[modifiers]") {
+    ChunkedDeque<std::string> deque(4);
+    deque.push_back("middle");
+    std::string& middle = deque.front();
+    const std::string* address = &middle;
+
+    for (int i = 0; i < 1000; i++) {
+        deque.push_back("back");
+        deque.push_front("front");
+    }
+
+    REQUIRE(&deque[1000] == address);
+    REQUIRE(middle == "middle");
+}
+
+TEST_CASE("Emptied blocks are recycled", "[memory]") {
+    ChunkedDeque<int> deque(4);
+
+    // A sliding queue frees a block at the front as it needs one at the back
+    for (int i = 0; i < 8; i++) deque.push_back(i);
+    for (int i = 0; i < 1000; i++) {
+        deque.push_back(i);
+        REQUIRE(deque.pop_front() >= 0);
+        REQUIRE(deque.spare_blocks() <= ChunkedDeque<int>::maxSpareBlocks);
+    }
+
+    while (!deque.empty()) deque.pop_back();
+    REQUIRE(deque.spare_blocks() > 0);
+
+    deque.shrink_to_fit();
+    REQUIRE(deque.spare_blocks() == 0);
+    deque.push_front(1);
+    deque.push_back(2);
+    REQUIRE(deque.front() == 1);
+    REQUIRE(deque.back() == 2);
+}
+
+TEST_CASE("Iterators support random-access algorithms", "[iterators]") {
+    ChunkedDeque<int> deque(8);
+    for (int i = 0; i < 100; i++) deque.push_front(i);
+
+    std::sort(deque.begin(), deque.end());
+    REQUIRE(std::is_sorted(deque.cbegin(), deque.cend()));
+    REQUIRE(std::lower_bound(deque.begin(), deque.end(), 42) - deque.begin() == 42);
+    REQUIRE(deque.end()[-1] == 99);
+
+    const ChunkedDeque<int>& view = deque;
+    ChunkedDeque<int>::const_iterator it = deque.begin();
+    REQUIRE(it == view.begin());
+    REQUIRE(*(it + 10) == 10);
+}
+
+TEST_CASE("Copy, move, equality and swap", "[copy][move]") {
+    ChunkedDeque<std::string> a(2);
+    for (int i = 0; i < 10; i++) a.push_back(std::to_string(i));
+
+    ChunkedDeque<std::string> b = a;
+    REQUIRE(a == b);
+    b.push_front("x");
+    REQUIRE(a != b);
+
+    ChunkedDeque<std::string> c = std::move(b);
+    REQUIRE(c.front() == "x");
+    REQUIRE(c.size() == 11);
+
+    swap(a, c);
+    REQUIRE(a.size() == 11);
+    REQUIRE(c.size() == 10);
+
+    a = c;
+    REQUIRE(a == c);
+}
+
+TEST_CASE("Elements are destroyed exactly once", "[memory]") {
+    auto tracker = std::make_shared<int>(0);
+    {
+        ChunkedDeque<std::shared_ptr<int>> deque(4);
+        for (int i = 0; i < 50; i++) {
+            deque.push_back(tracker);
+            deque.emplace_front(tracker);
+        }
+        for (int i = 0; i < 30; i++) deque.pop_front();
+        deque.clear();
+        REQUIRE(tracker.use_count() == 1);
+
+        for (int i = 0; i < 10; i++) deque.push_back(tracker);
+    }
+    REQUIRE(tracker.use_count() == 1);
+}
+
+TEST_CASE("Errors", "[exceptions]") {
+    ChunkedDeque<int> deque;
+    REQUIRE_THROWS_AS(deque.front(), std::out_of_range);
+    REQUIRE_THROWS_AS(deque.back(), std::out_of_range);
+    REQUIRE_THROWS_AS(deque.pop_front(), std::out_of_range);
+    REQUIRE_THROWS_AS(deque.pop_back(), std::out_of_range);
+
+    deque.push_back(1);
+    REQUIRE_THROWS_AS(deque.at(1), std::out_of_range);
+    REQUIRE(deque.at(0) == 1);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "epoch.hpp"
+
+// Lock-free sorted set (Harris/Michael). Erasure first marks the low bit of
+// the victim's next pointer, which freezes it logically, and then unlinks
+// it; traversals that meet a marked node help unlink it. Unlinked nodes are
+// handed to the global EpochDomain, so readers never touch freed memory.
+template <typename T>
+class ConcurrentSortedList {
+private:
+    struct Node {
+        T value;
+        std::atomic<Node*> next{nullptr};
+
+        Node() = default;
+        explicit Node(const T& v, Node* n = nullptr) : value(v), next(n) {}
+    };
+
+    struct Position {
+        std::atomic<Node*>* prev;
+        Node* curr;
+    };
+
+    Node* sentinel_ = nullptr;
+
+    static bool isMarked(Node* node) noexcept;
+    static Node* marked(Node* node) noexcept;
+    static Node* unmarked(Node* node) noexcept;
+
+    // First live node whose value is not less than `value`, unlinking marked
+    // nodes met on the way. Must be called while pinned.
+    Position search(const T& value);
+public:
+    ConcurrentSortedList();
+    ConcurrentSortedList(const ConcurrentSortedList&) = delete;
+    ConcurrentSortedList& operator=(const ConcurrentSortedList&) = delete;
+
+    // Not safe against concurrent operations on this list.
+    ~ConcurrentSortedList();
+
+    bool insert(const T& value);
+    bool erase(const T& value);
+    bool contains(const T& value) const;
+
+    // Traversal count; exact only when there are no concurrent writers.
+    std::size_t size() const;
+    bool empty() const;
+};
+
+#include "concurrent_list.inl"
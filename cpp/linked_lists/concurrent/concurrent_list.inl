@@ -0,0 +1,144 @@
+#include "concurrent_list.hpp"
+
+// ### Marked pointers ###
+
+template <typename T>
+bool ConcurrentSortedList<T>::isMarked(Node* node) noexcept {
+    return (reinterpret_cast<std::uintptr_t>(node) & 1) != 0;
+}
+
+template <typename T>
+typename ConcurrentSortedList<T>::Node* ConcurrentSortedList<T>::marked(Node* node) noexcept {
+    return reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(node) | 1);
+}
+
+template <typename T>
+typename ConcurrentSortedList<T>::Node* ConcurrentSortedList<T>::unmarked(Node* node) noexcept {
+    return reinterpret_cast<Node*>(reinterpret_cast<std::uintptr_t>(node) & ~std::uintptr_t(1));
+}
+
+// ### Constructors and destructor ###
+
+template <typename T>
+ConcurrentSortedList<T>::ConcurrentSortedList() : sentinel_(new Node()) {}
+
+template <typename T>
+ConcurrentSortedList<T>::~ConcurrentSortedList() {
+    Node* curr = sentinel_;
+    while (curr != nullptr) {
+        Node* next = unmarked(curr->next.load(std::memory_order_relaxed));
+        delete curr;
+        curr = next;
+    }
+}
+
+// ### Traversal ###
+
+template <typename T>
+typename ConcurrentSortedList<T>::Position ConcurrentSortedList<T>::search(const T& value) {
+retry:
+    std::atomic<Node*>* prev = &sentinel_->next;
+    Node* curr = prev->load(std::memory_order_acquire);
+
+    while (curr != nullptr) {
+        Node* next = curr->next.load(std::memory_order_acquire);
+
+        if (isMarked(next)) {
+            // curr is logically erased; whoever unlinks it retires it
+            if (!prev->compare_exchange_strong(curr, unmarked(next), std::memory_order_acq_rel, std::memory_order_acquire)) {
+                goto retry;
+            }
+            EpochDomain::global().retire(curr);
+            curr = unmarked(next);
+            continue;
+        }
+
+        if (!(curr->value < value)) break;
+
+        prev = &curr->next;
+        curr = next;
+    }
+
+    return {prev, curr};
+}
+
+template <typename T>
+bool ConcurrentSortedList<T>::contains(const T& value) const {
+    auto guard = EpochDomain::global().pin();
+
+    // Wait-free: never writes and never restarts
+    Node* curr = sentinel_->next.load(std::memory_order_acquire);
+    while (curr != nullptr && curr->value < value) {
+        curr = unmarked(curr->next.load(std::memory_order_acquire));
+    }
+
+    return curr != nullptr && !(value < curr->value) && !isMarked(curr->next.load(std::memory_order_acquire));
+}
+
+template <typename T>
+std::size_t ConcurrentSortedList<T>::size() const {
+    auto guard = EpochDomain::global().pin();
+
+    std::size_t count = 0;
+    Node* curr = sentinel_->next.load(std::memory_order_acquire);
+    while (curr != nullptr) {
+        Node* next = curr->next.load(std::memory_order_acquire);
+        if (!isMarked(next)) count++;
+        curr = unmarked(next);
+    }
+
+    return count;
+}
+
+template <typename T>
+bool ConcurrentSortedList<T>::empty() const {
+    return size() == 0;
+}
+
+// ### Modifier methods ###
+
+template <typename T>
+bool ConcurrentSortedList<T>::insert(const T& value) {
+    auto guard = EpochDomain::global().pin();
+
+    Node* node = nullptr;
+    while (true) {
+        auto [prev, curr] = search(value);
+        if (curr != nullptr && !(value < curr->value)) {
+            delete node;
+            return false;
+        }
+
+        if (node == nullptr) node = new Node(value);
+        node->next.store(curr, std::memory_order_relaxed);
+
+        if (prev->compare_exchange_strong(curr, node, std::memory_order_release, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+}
+
+template <typename T>
+bool ConcurrentSortedList<T>::erase(const T& value) {
+    auto guard = EpochDomain::global().pin();
+
+    while (true) {
+        auto [prev, curr] = search(value);
+        if (curr == nullptr || value < curr->value) return false;
+
+        Node* next = curr->next.load(std::memory_order_acquire);
+        if (isMarked(next)) continue;
+
+        // The mark is the linearization point
+        if (!curr->next.compare_exchange_strong(next, marked(next), std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            continue;
+        }
+
+        if (prev->compare_exchange_strong(curr, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+            EpochDomain::global().retire(curr);
+        } else {
+            search(value);
+        }
+        return true;
+    }
+}
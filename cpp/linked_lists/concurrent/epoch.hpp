@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Epoch-based reclamation. Readers pin the current epoch for the duration of
+// an operation; memory retired in epoch e is freed once the global epoch has
+// reached e + 2, at which point no pinned thread can still reference it.
+class EpochDomain {
+private:
+    struct Retired {
+        void* ptr;
+        void (*deleter)(void*);
+        std::uint64_t epoch;
+    };
+
+    struct alignas(64) Record {
+        // (epoch << 1) | 1 while pinned, 0 while idle
+        std::atomic<std::uint64_t> state{0};
+        std::atomic<bool> inUse{false};
+        std::size_t depth = 0;
+        std::vector<Retired> retired;
+        Record* next = nullptr;
+    };
+
+    static constexpr std::size_t collectInterval = 64;
+
+    std::atomic<std::uint64_t> epoch_{1};
+    std::atomic<Record*> records_{nullptr};
+
+    EpochDomain() = default;
+
+    Record& localRecord();
+    Record* acquireRecord();
+    bool tryAdvance() noexcept;
+    void collect(Record& record);
+public:
+    class Guard {
+    private:
+        EpochDomain* domain_;
+        Record* record_;
+    public:
+        Guard(EpochDomain& domain, Record& record) noexcept;
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+        ~Guard();
+    };
+
+    EpochDomain(const EpochDomain&) = delete;
+    EpochDomain& operator=(const EpochDomain&) = delete;
+    ~EpochDomain();
+
+    static EpochDomain& global();
+
+    Guard pin();
+
+    // Must be called while pinned, after ptr has been unlinked.
+    void retire(void* ptr, void (*deleter)(void*));
+
+    template <typename T>
+    void retire(T* ptr);
+
+    // Frees whatever the calling thread retired that is already safe.
+    void collect();
+
+    std::uint64_t epoch() const noexcept;
+};
+
+#include "epoch.inl"
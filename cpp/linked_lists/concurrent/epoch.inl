@@ -0,0 +1,120 @@
+#include "epoch.hpp"
+
+// ### Domain ###
+
+inline EpochDomain::~EpochDomain() {
+    Record* record = records_.load(std::memory_order_acquire);
+    while (record != nullptr) {
+        Record* next = record->next;
+        for (const Retired& r : record->retired) r.deleter(r.ptr);
+        delete record;
+        record = next;
+    }
+}
+
+inline EpochDomain& EpochDomain::global() {
+    static EpochDomain domain;
+    return domain;
+}
+
+inline std::uint64_t EpochDomain::epoch() const noexcept {
+    return epoch_.load(std::memory_order_acquire);
+}
+
+// ### Thread records ###
+
+inline EpochDomain::Record* EpochDomain::acquireRecord() {
+    for (Record* record = records_.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+        bool expected = false;
+        if (!record->inUse.load(std::memory_order_relaxed) &&
+            record->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            return record;
+        }
+    }
+
+    Record* record = new Record();
+    record->inUse.store(true, std::memory_order_relaxed);
+    Record* head = records_.load(std::memory_order_relaxed);
+    do {
+        record->next = head;
+    } while (!records_.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+
+    return record;
+}
+
+inline EpochDomain::Record& EpochDomain::localRecord() {
+    // Records outlive their threads: on exit the record is handed back,
+    // and whatever it still has retired is inherited by the next owner.
+    struct Owner {
+        Record* record = nullptr;
+        ~Owner() {
+            if (record != nullptr) record->inUse.store(false, std::memory_order_release);
+        }
+    };
+    static thread_local Owner owner;
+
+    if (owner.record == nullptr) owner.record = acquireRecord();
+    return *owner.record;
+}
+
+// ### Pinning ###
+
+inline EpochDomain::Guard::Guard(EpochDomain& domain, Record& record) noexcept : domain_(&domain), record_(&record) {
+    if (record_->depth++ == 0) {
+        std::uint64_t epoch = domain_->epoch_.load(std::memory_order_relaxed);
+        record_->state.store((epoch << 1) | 1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+inline EpochDomain::Guard::~Guard() {
+    if (--record_->depth == 0) record_->state.store(0, std::memory_order_release);
+}
+
+inline EpochDomain::Guard EpochDomain::pin() {
+    return Guard(*this, localRecord());
+}
+
+// ### Reclamation ###
+
+inline bool EpochDomain::tryAdvance() noexcept {
+    std::uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+
+    for (Record* record = records_.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+        std::uint64_t state = record->state.load(std::memory_order_seq_cst);
+        if ((state & 1) != 0 && (state >> 1) != epoch) return false;
+    }
+
+    return epoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_acq_rel);
+}
+
+inline void EpochDomain::retire(void* ptr, void (*deleter)(void*)) {
+    Record& record = localRecord();
+    record.retired.push_back({ptr, deleter, epoch_.load(std::memory_order_acquire)});
+
+    if (record.retired.size() % collectInterval == 0) collect(record);
+}
+
+template <typename T>
+void EpochDomain::retire(T* ptr) {
+    retire(static_cast<void*>(ptr), [](void* p) { delete static_cast<T*>(p); });
+}
+
+inline void EpochDomain::collect(Record& record) {
+    tryAdvance();
+    std::uint64_t epoch = epoch_.load(std::memory_order_acquire);
+
+    std::size_t kept = 0;
+    for (const Retired& r : record.retired) {
+        if (r.epoch + 2 <= epoch) {
+            r.deleter(r.ptr);
+        } else {
+            record.retired[kept++] = r;
+        }
+    }
+    record.retired.resize(kept);
+}
+
+inline void EpochDomain::collect() {
+    collect(localRecord());
+}
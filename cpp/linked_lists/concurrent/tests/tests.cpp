@@ -0,0 +1,99 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../concurrent_list.hpp"
+
+TEST_CASE("Default construction", "[constructor]") {
+    ConcurrentSortedList<int> list;
+
+    REQUIRE(list.size() == 0);
+    REQUIRE(list.empty());
+    REQUIRE_FALSE(list.contains(0));
+}
+
+TEST_CASE("insert keeps a set", "[modifiers]") {
+    ConcurrentSortedList<int> list;
+
+    REQUIRE(list.insert(3));
+    REQUIRE(list.insert(1));
+    REQUIRE(list.insert(2));
+    REQUIRE_FALSE(list.insert(2));
+
+    REQUIRE(list.size() == 3);
+    REQUIRE(list.contains(1));
+    REQUIRE(list.contains(2));
+    REQUIRE(list.contains(3));
+    REQUIRE_FALSE(list.contains(4));
+}
+
+TEST_CASE("erase removes only present values", "[modifiers]") {
+    ConcurrentSortedList<std::string> list;
+    list.insert("b");
+    list.insert("a");
+    list.insert("c");
+
+    REQUIRE(list.erase("b"));
+    REQUIRE_FALSE(list.erase("b"));
+    REQUIRE_FALSE(list.erase("z"));
+
+    REQUIRE(list.size() == 2);
+    REQUIRE_FALSE(list.contains("b"));
+    REQUIRE(list.contains("a"));
+    REQUIRE(list.contains("c"));
+
+    REQUIRE(list.insert("b"));
+    REQUIRE(list.contains("b"));
+}
+
+TEST_CASE("concurrent inserts and erases of disjoint ranges", "[concurrent]") {
+    ConcurrentSortedList<int> list;
+    constexpr int threads = 4;
+    constexpr int perThread = 2000;
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            for (int i = 0; i < perThread; i++) list.insert(i * threads + t);
+            // Erase the odd values again
+            for (int i = 1; i < perThread; i += 2) list.erase(i * threads + t);
+        });
+    }
+    for (auto& worker : workers) worker.join();
+
+    REQUIRE(list.size() == threads * perThread / 2);
+    for (int i = 0; i < perThread; i++) {
+        for (int t = 0; t < threads; t++) {
+            REQUIRE(list.contains(i * threads + t) == (i % 2 == 0));
+        }
+    }
+}
+
+TEST_CASE("contending threads agree on a single winner per value", "[concurrent]") {
+    ConcurrentSortedList<int> list;
+    constexpr int threads = 4;
+    constexpr int values = 500;
+
+    std::atomic<int> inserted{0};
+    std::atomic<int> erased{0};
+
+    auto race = [&](auto op) {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++) {
+            workers.emplace_back([&] {
+                for (int v = 0; v < values; v++) op(v);
+            });
+        }
+        for (auto& worker : workers) worker.join();
+    };
+
+    race([&](int v) { inserted += list.insert(v); });
+    REQUIRE(inserted == values);
+    REQUIRE(list.size() == values);
+
+    race([&](int v) { erased += list.erase(v); });
+    REQUIRE(erased == values);
+    REQUIRE(list.empty());
+}
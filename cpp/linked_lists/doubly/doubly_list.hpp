@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "stats.hpp"
+
+// pointers keeps a prev and a next pointer per node. xor_links stores only
+// prev ^ next, halving link overhead; a node's neighbours are then recovered
+// from the node it was reached from, so iterators carry that node along and
+// are invalidated by insertions or erasures next to them.
+enum class LinkMode { pointers, xor_links };
+
+template <typename T, typename Stats = NoStats, LinkMode Links = LinkMode::pointers>
+class DoublyLinkedList {
+private:
+    struct PointerLink {
+        PointerLink* prev = nullptr;
+        PointerLink* next = nullptr;
+    };
+
+    struct XorLink {
+        std::uintptr_t link = 0;
+    };
+
+    using Link = std::conditional_t<Links == LinkMode::pointers, PointerLink, XorLink>;
+
+    struct Node : Link {
+        T value;
+
+        explicit Node(const T& v) : value(v) {}
+        explicit Node(T&& v) : value(std::move(v)) {}
+    };
+
+    // Sentinels hold no value and are never cast to Node
+    Link head_;
+    Link tail_;
+    std::size_t size_ = 0;
+
+    [[no_unique_address]] mutable Stats stats_;
+
+    // Link helpers: neighbours are always addressed relative to the node on
+    // the other side, which is all the XOR encoding can answer.
+    static Link* after(const Link* prev, const Link* curr) noexcept;
+    static Link* before(const Link* curr, const Link* next) noexcept;
+    static void setLinks(Link* node, Link* prev, Link* next) noexcept;
+    static void replaceNext(Link* node, Link* oldNext, Link* newNext) noexcept;
+    static void replacePrev(Link* node, Link* oldPrev, Link* newPrev) noexcept;
+
+    Link* first() const noexcept;
+    Link* last() const noexcept;
+
+    Node* linkBetween(Node* node, Link* prev, Link* next) noexcept;
+    T unlink(Link* prev, Link* curr, Link* next);
+    void adopt(DoublyLinkedList& other) noexcept;
+public:
+    template <bool Const>
+    class basic_iterator {
+    private:
+        // prev_ is only maintained in xor_links mode
+        Link* prev_ = nullptr;
+        Link* curr_ = nullptr;
+        friend class DoublyLinkedList;
+        friend class basic_iterator<!Const>;
+
+        basic_iterator(const Link* prev, const Link* curr) noexcept
+            : prev_(const_cast<Link*>(prev)), curr_(const_cast<Link*>(curr)) {}
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        basic_iterator() noexcept = default;
+        template <bool C = Const> requires C
+        basic_iterator(const basic_iterator<false>& it) noexcept : prev_(it.prev_), curr_(it.curr_) {}
+
+        reference operator*() const { return static_cast<Node*>(curr_)->value; }
+        pointer operator->() const { return &static_cast<Node*>(curr_)->value; }
+
+        basic_iterator& operator++() noexcept {
+            if constexpr (Links == LinkMode::pointers) {
+                curr_ = curr_->next;
+            } else {
+                Link* next = after(prev_, curr_);
+                prev_ = curr_;
+                curr_ = next;
+            }
+            return *this;
+        }
+
+        basic_iterator operator++(int) noexcept {
+            basic_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        basic_iterator& operator--() noexcept {
+            if constexpr (Links == LinkMode::pointers) {
+                curr_ = curr_->prev;
+            } else {
+                Link* prev = before(prev_, curr_);
+                curr_ = prev_;
+                prev_ = prev;
+            }
+            return *this;
+        }
+
+        basic_iterator operator--(int) noexcept {
+            basic_iterator tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        friend bool operator==(const basic_iterator& a, const basic_iterator& b) noexcept { return a.curr_ == b.curr_; }
+    };
+
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+private:
+    static Link* prevOf(const_iterator pos) noexcept;
+public:
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator cend() const noexcept;
+    reverse_iterator rbegin() noexcept;
+    reverse_iterator rend() noexcept;
+    const_reverse_iterator crbegin() const noexcept;
+    const_reverse_iterator crend() const noexcept;
+
+    DoublyLinkedList() noexcept;
+    DoublyLinkedList(const DoublyLinkedList& other);
+    DoublyLinkedList(DoublyLinkedList&& other) noexcept;
+
+    ~DoublyLinkedList() noexcept;
+
+    DoublyLinkedList& operator=(const DoublyLinkedList& other);
+    DoublyLinkedList& operator=(DoublyLinkedList&& other) noexcept;
+
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+
+    T& front();
+    const T& front() const;
+    T& back();
+    const T& back() const;
+
+    // Walks from whichever end is nearer
+    T& at(std::size_t pos);
+    const T& at(std::size_t pos) const;
+    T& operator[](std::size_t pos);
+    const T& operator[](std::size_t pos) const;
+
+    iterator find(const T& value);
+    const_iterator find(const T& value) const;
+
+    void push_front(const T& value);
+    void push_front(T&& value);
+    void push_back(const T& value);
+    void push_back(T&& value);
+    iterator insert(const_iterator pos, const T& value);
+
+    T pop_front();
+    T pop_back();
+    iterator erase(const_iterator pos);
+
+    void clear() noexcept;
+
+    bool operator==(const DoublyLinkedList& other) const;
+
+    ContainerStats stats() const noexcept;
+    void reset_stats() noexcept;
+};
+
+template <typename T, typename Stats = NoStats>
+using XorLinkedList = DoublyLinkedList<T, Stats, LinkMode::xor_links>;
+
+#include "doubly_list.inl"
@@ -0,0 +1,433 @@
+#include "doubly_list.hpp"
+
+#include <stdexcept>
+
+// ### Link helpers ###
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::Link*
+DoublyLinkedList<T, Stats, Links>::after(const Link* prev, const Link* curr) noexcept {
+    if constexpr (Links == LinkMode::pointers) {
+        return curr->next;
+    } else {
+        return reinterpret_cast<Link*>(curr->link ^ reinterpret_cast<std::uintptr_t>(prev));
+    }
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::Link*
+DoublyLinkedList<T, Stats, Links>::before(const Link* curr, const Link* next) noexcept {
+    if constexpr (Links == LinkMode::pointers) {
+        return curr->prev;
+    } else {
+        return reinterpret_cast<Link*>(curr->link ^ reinterpret_cast<std::uintptr_t>(next));
+    }
+}
+
+template <typename T, typename Stats, LinkMode Links>
+void DoublyLinkedList<T, Stats, Links>::setLinks(Link* node, Link* prev, Link* next) noexcept {
+    if constexpr (Links == LinkMode::pointers) {
+        node->prev = prev;
+        node->next = next;
+    } else {
+        node->link = reinterpret_cast<std::uintptr_t>(prev) ^ reinterpret_cast<std::uintptr_t>(next);
+    }
+}
+
+template <typename T, typename Stats, LinkMode Links>
+void DoublyLinkedList<T, Stats, Links>::replaceNext(Link* node, Link* oldNext, Link* newNext) noexcept {
+    if constexpr (Links == LinkMode::pointers) {
+        node->next = newNext;
+    } else {
+        node->link ^= reinterpret_cast<std::uintptr_t>(oldNext) ^ reinterpret_cast<std::uintptr_t>(newNext);
+    }
+}
+
+template <typename T, typename Stats, LinkMode Links>
+void DoublyLinkedList<T, Stats, Links>::replacePrev(Link* node, Link* oldPrev, Link* newPrev) noexcept {
+    if constexpr (Links == LinkMode::pointers) {
+        node->prev = newPrev;
+    } else {
+        node->link ^= reinterpret_cast<std::uintptr_t>(oldPrev) ^ reinterpret_cast<std::uintptr_t>(newPrev);
+    }
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::Link*
+DoublyLinkedList<T, Stats, Links>::first() const noexcept {
+    return after(nullptr, &head_);
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::Link*
+DoublyLinkedList<T, Stats, Links>::last() const noexcept {
+    return before(&tail_, nullptr);
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::Link*
+DoublyLinkedList<T, Stats, Links>::prevOf(const_iterator pos) noexcept {
+    if constexpr (Links == LinkMode::pointers) {
+        return pos.curr_->prev;
+    } else {
+        return pos.prev_;
+    }
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::Node*
+DoublyLinkedList<T, Stats, Links>::linkBetween(Node* node, Link* prev, Link* next) noexcept {
+    setLinks(node, prev, next);
+    replaceNext(prev, next, node);
+    replacePrev(next, prev, node);
+    size_++;
+    stats_.record_size(size_);
+    return node;
+}
+
+template <typename T, typename Stats, LinkMode Links>
+T DoublyLinkedList<T, Stats, Links>::unlink(Link* prev, Link* curr, Link* next) {
+    replaceNext(prev, curr, next);
+    replacePrev(next, curr, prev);
+    size_--;
+
+    Node* node = static_cast<Node*>(curr);
+    T value = std::move(node->value);
+    delete node;
+    stats_.record_free();
+
+    return value;
+}
+
+template <typename T, typename Stats, LinkMode Links>
+void DoublyLinkedList<T, Stats, Links>::adopt(DoublyLinkedList& other) noexcept {
+    // Nodes point at the sentinels, which live inside the object
+    if (other.empty()) return;
+
+    Link* front = other.first();
+    Link* back = other.last();
+    setLinks(&head_, nullptr, front);
+    setLinks(&tail_, back, nullptr);
+    replacePrev(front, &other.head_, &head_);
+    replaceNext(back, &other.tail_, &tail_);
+    size_ = other.size_;
+
+    setLinks(&other.head_, nullptr, &other.tail_);
+    setLinks(&other.tail_, &other.head_, nullptr);
+    other.size_ = 0;
+}
+
+// ### Iteration ###
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::iterator DoublyLinkedList<T, Stats, Links>::begin() noexcept {
+    return iterator(&head_, first());
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::iterator DoublyLinkedList<T, Stats, Links>::end() noexcept {
+    return iterator(last(), &tail_);
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::const_iterator DoublyLinkedList<T, Stats, Links>::begin() const noexcept {
+    return cbegin();
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::const_iterator DoublyLinkedList<T, Stats, Links>::end() const noexcept {
+    return cend();
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::const_iterator DoublyLinkedList<T, Stats, Links>::cbegin() const noexcept {
+    return const_iterator(&head_, first());
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::const_iterator DoublyLinkedList<T, Stats, Links>::cend() const noexcept {
+    return const_iterator(last(), &tail_);
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::reverse_iterator DoublyLinkedList<T, Stats, Links>::rbegin() noexcept {
+    return reverse_iterator(end());
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::reverse_iterator DoublyLinkedList<T, Stats, Links>::rend() noexcept {
+    return reverse_iterator(begin());
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::const_reverse_iterator DoublyLinkedList<T, Stats, Links>::crbegin() const noexcept {
+    return const_reverse_iterator(cend());
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::const_reverse_iterator DoublyLinkedList<T, Stats, Links>::crend() const noexcept {
+    return const_reverse_iterator(cbegin());
+}
+
+// ### Constructors ###
+
+template <typename T, typename Stats, LinkMode Links>
+DoublyLinkedList<T, Stats, Links>::DoublyLinkedList() noexcept {
+    setLinks(&head_, nullptr, &tail_);
+    setLinks(&tail_, &head_, nullptr);
+}
+
+template <typename T, typename Stats, LinkMode Links>
+DoublyLinkedList<T, Stats, Links>::DoublyLinkedList(const DoublyLinkedList& other) : DoublyLinkedList() {
+    for (const T& value : other) push_back(value);
+}
+
+template <typename T, typename Stats, LinkMode Links>
+DoublyLinkedList<T, Stats, Links>::DoublyLinkedList(DoublyLinkedList&& other) noexcept : DoublyLinkedList() {
+    adopt(other);
+}
+
+// ### Destructor ###
+
+template <typename T, typename Stats, LinkMode Links>
+DoublyLinkedList<T, Stats, Links>::~DoublyLinkedList() noexcept {
+    clear();
+}
+
+// ### = operator ###
+
+template <typename T, typename Stats, LinkMode Links>
+DoublyLinkedList<T, Stats, Links>& DoublyLinkedList<T, Stats, Links>::operator=(const DoublyLinkedList& other) {
+    if (this != &other) {
+        clear();
+        for (const T& value : other) push_back(value);
+    }
+    return *this;
+}
+
+template <typename T, typename Stats, LinkMode Links>
+DoublyLinkedList<T, Stats, Links>& DoublyLinkedList<T, Stats, Links>::operator=(DoublyLinkedList&& other) noexcept {
+    if (this != &other) {
+        clear();
+        adopt(other);
+    }
+    return *this;
+}
+
+// ### Capacity methods ###
+
+template <typename T, typename Stats, LinkMode Links>
+std::size_t DoublyLinkedList<T, Stats, Links>::size() const noexcept { return size_; }
+
+template <typename T, typename Stats, LinkMode Links>
+bool DoublyLinkedList<T, Stats, Links>::empty() const noexcept { return size_ == 0; }
+
+// ### Element access methods ###
+
+template <typename T, typename Stats, LinkMode Links>
+T& DoublyLinkedList<T, Stats, Links>::front() {
+    return const_cast<T&>(std::as_const(*this).front());
+}
+
+template <typename T, typename Stats, LinkMode Links>
+const T& DoublyLinkedList<T, Stats, Links>::front() const {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::access);
+    if (empty()) {
+        stats_.record_exception(Operation::access);
+        throw std::out_of_range("front on empty list");
+    }
+    return static_cast<const Node*>(first())->value;
+}
+
+template <typename T, typename Stats, LinkMode Links>
+T& DoublyLinkedList<T, Stats, Links>::back() {
+    return const_cast<T&>(std::as_const(*this).back());
+}
+
+template <typename T, typename Stats, LinkMode Links>
+const T& DoublyLinkedList<T, Stats, Links>::back() const {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::access);
+    if (empty()) {
+        stats_.record_exception(Operation::access);
+        throw std::out_of_range("back on empty list");
+    }
+    return static_cast<const Node*>(last())->value;
+}
+
+template <typename T, typename Stats, LinkMode Links>
+T& DoublyLinkedList<T, Stats, Links>::at(std::size_t pos) {
+    return const_cast<T&>(std::as_const(*this).at(pos));
+}
+
+template <typename T, typename Stats, LinkMode Links>
+const T& DoublyLinkedList<T, Stats, Links>::at(std::size_t pos) const {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::at);
+    if (pos >= size_) {
+        stats_.record_exception(Operation::at);
+        throw std::out_of_range("at pos out of range");
+    }
+
+    const_iterator it;
+    if (pos < size_ / 2) {
+        stats_.record_visits(Operation::at, pos + 1);
+        it = cbegin();
+        while (pos--) ++it;
+    } else {
+        std::size_t steps = size_ - pos;
+        stats_.record_visits(Operation::at, steps);
+        it = cend();
+        while (steps--) --it;
+    }
+    return *it;
+}
+
+template <typename T, typename Stats, LinkMode Links>
+T& DoublyLinkedList<T, Stats, Links>::operator[](std::size_t pos) {
+    return at(pos);
+}
+
+template <typename T, typename Stats, LinkMode Links>
+const T& DoublyLinkedList<T, Stats, Links>::operator[](std::size_t pos) const {
+    return at(pos);
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::iterator DoublyLinkedList<T, Stats, Links>::find(const T& value) {
+    const_iterator it = std::as_const(*this).find(value);
+    return iterator(it.prev_, it.curr_);
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::const_iterator DoublyLinkedList<T, Stats, Links>::find(const T& value) const {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::find);
+
+    std::size_t visited = 0;
+    const_iterator it = cbegin();
+    for (; it != cend(); ++it) {
+        visited++;
+        if (*it == value) break;
+    }
+    stats_.record_visits(Operation::find, visited);
+    return it;
+}
+
+// ### Modifier methods ###
+
+template <typename T, typename Stats, LinkMode Links>
+void DoublyLinkedList<T, Stats, Links>::push_front(const T& value) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::push);
+    stats_.record_allocation();
+    linkBetween(new Node(value), &head_, first());
+}
+
+template <typename T, typename Stats, LinkMode Links>
+void DoublyLinkedList<T, Stats, Links>::push_front(T&& value) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::push);
+    stats_.record_allocation();
+    linkBetween(new Node(std::move(value)), &head_, first());
+}
+
+template <typename T, typename Stats, LinkMode Links>
+void DoublyLinkedList<T, Stats, Links>::push_back(const T& value) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::push);
+    stats_.record_allocation();
+    linkBetween(new Node(value), last(), &tail_);
+}
+
+template <typename T, typename Stats, LinkMode Links>
+void DoublyLinkedList<T, Stats, Links>::push_back(T&& value) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::push);
+    stats_.record_allocation();
+    linkBetween(new Node(std::move(value)), last(), &tail_);
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::iterator
+DoublyLinkedList<T, Stats, Links>::insert(const_iterator pos, const T& value) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::insert);
+    Link* prev = prevOf(pos);
+    stats_.record_allocation();
+    Node* node = linkBetween(new Node(value), prev, pos.curr_);
+    return iterator(prev, node);
+}
+
+template <typename T, typename Stats, LinkMode Links>
+T DoublyLinkedList<T, Stats, Links>::pop_front() {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::pop);
+    if (empty()) {
+        stats_.record_exception(Operation::pop);
+        throw std::out_of_range("pop_front on empty list");
+    }
+
+    Link* front = first();
+    return unlink(&head_, front, after(&head_, front));
+}
+
+template <typename T, typename Stats, LinkMode Links>
+T DoublyLinkedList<T, Stats, Links>::pop_back() {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::pop);
+    if (empty()) {
+        stats_.record_exception(Operation::pop);
+        throw std::out_of_range("pop_back on empty list");
+    }
+
+    Link* back = last();
+    return unlink(before(back, &tail_), back, &tail_);
+}
+
+template <typename T, typename Stats, LinkMode Links>
+typename DoublyLinkedList<T, Stats, Links>::iterator
+DoublyLinkedList<T, Stats, Links>::erase(const_iterator pos) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::erase);
+    if (pos.curr_ == &tail_ || pos.curr_ == nullptr) {
+        stats_.record_exception(Operation::erase);
+        throw std::out_of_range("erase at end");
+    }
+
+    Link* prev = prevOf(pos);
+    Link* next = after(prev, pos.curr_);
+    unlink(prev, pos.curr_, next);
+    return iterator(prev, next);
+}
+
+template <typename T, typename Stats, LinkMode Links>
+void DoublyLinkedList<T, Stats, Links>::clear() noexcept {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::clear);
+
+    Link* prev = &head_;
+    Link* curr = first();
+    while (curr != &tail_) {
+        Link* next = after(prev, curr);
+        prev = curr;
+        delete static_cast<Node*>(curr);
+        stats_.record_free();
+        curr = next;
+    }
+
+    setLinks(&head_, nullptr, &tail_);
+    setLinks(&tail_, &head_, nullptr);
+    size_ = 0;
+}
+
+// ### Operators ###
+
+template <typename T, typename Stats, LinkMode Links>
+bool DoublyLinkedList<T, Stats, Links>::operator==(const DoublyLinkedList& other) const {
+    if (size_ != other.size_) return false;
+    for (auto a = cbegin(), b = other.cbegin(); a != cend(); ++a, ++b) {
+        if (!(*a == *b)) return false;
+    }
+    return true;
+}
+
+// ### Statistics ###
+
+template <typename T, typename Stats, LinkMode Links>
+ContainerStats DoublyLinkedList<T, Stats, Links>::stats() const noexcept {
+    return stats_.snapshot();
+}
+
+template <typename T, typename Stats, LinkMode Links>
+void DoublyLinkedList<T, Stats, Links>::reset_stats() noexcept {
+    stats_.reset();
+}
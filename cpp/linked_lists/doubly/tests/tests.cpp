@@ -0,0 +1,148 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../doubly_list.hpp"
+
+template <typename List>
+static std::vector<typename List::const_iterator::value_type> forward(const List& list) {
+    return {list.cbegin(), list.cend()};
+}
+
+template <typename List>
+static std::vector<typename List::const_iterator::value_type> backward(const List& list) {
+    return {list.crbegin(), list.crend()};
+}
+
+TEMPLATE_TEST_CASE("Default construction", "[constructor]", DoublyLinkedList<int>, XorLinkedList<int>) {
+    TestType list;
+
+    REQUIRE(list.size() == 0);
+    REQUIRE(list.empty());
+    REQUIRE(list.begin() == list.end());
+    REQUIRE(list.rbegin() == list.rend());
+}
+
+TEMPLATE_TEST_CASE("push and pop at both ends", "[modifiers]", DoublyLinkedList<int>, XorLinkedList<int>) {
+    TestType list;
+    list.push_back(2);
+    list.push_front(1);
+    list.push_back(3);
+
+    REQUIRE(list.size() == 3);
+    REQUIRE(list.front() == 1);
+    REQUIRE(list.back() == 3);
+    REQUIRE(forward(list) == std::vector<int>{1, 2, 3});
+    REQUIRE(backward(list) == std::vector<int>{3, 2, 1});
+
+    REQUIRE(list.pop_back() == 3);
+    REQUIRE(list.pop_front() == 1);
+    REQUIRE(list.pop_back() == 2);
+    REQUIRE(list.empty());
+
+    REQUIRE_THROWS_AS(list.pop_back(), std::out_of_range);
+    REQUIRE_THROWS_AS(list.pop_front(), std::out_of_range);
+    REQUIRE_THROWS_AS(list.front(), std::out_of_range);
+    REQUIRE_THROWS_AS(list.back(), std::out_of_range);
+}
+
+TEMPLATE_TEST_CASE("at walks from the nearer end", "[access]", (DoublyLinkedList<int, CountingStats>), (XorLinkedList<int, CountingStats>)) {
+    TestType list;
+    for (int i = 0; i < 100; ++i) list.push_back(i);
+
+    for (int i = 0; i < 100; ++i) REQUIRE(list.at(i) == i);
+    REQUIRE_THROWS_AS(list.at(100), std::out_of_range);
+
+    list.reset_stats();
+    list.at(0);
+    list.at(99);
+    REQUIRE(list.stats()[Operation::at].nodesVisited == 2);
+
+    list[98] = -1;
+    REQUIRE(list.at(98) == -1);
+}
+
+TEMPLATE_TEST_CASE("insert and erase through iterators", "[modifiers]", DoublyLinkedList<std::string>, XorLinkedList<std::string>) {
+    TestType list;
+    for (const char* s : {"a", "c", "e"}) list.push_back(s);
+
+    auto it = list.find("c");
+    REQUIRE(*it == "c");
+    it = list.insert(it, "b");
+    REQUIRE(*it == "b");
+    REQUIRE(it->size() == 1);
+
+    it = list.insert(list.end(), "f");
+    REQUIRE(list.back() == "f");
+    it = list.insert(list.begin(), "_");
+    REQUIRE(list.front() == "_");
+
+    it = list.erase(list.find("e"));
+    REQUIRE(*it == "f");
+    it = list.erase(it);
+    REQUIRE(it == list.end());
+    it = list.erase(list.begin());
+    REQUIRE(*it == "a");
+    REQUIRE_THROWS_AS(list.erase(list.end()), std::out_of_range);
+
+    REQUIRE(forward(list) == std::vector<std::string>{"a", "b", "c"});
+    REQUIRE(backward(list) == std::vector<std::string>{"c", "b", "a"});
+    REQUIRE(list.find("z") == list.end());
+}
+
+TEMPLATE_TEST_CASE("bidirectional iteration", "[iterators]", DoublyLinkedList<int>, XorLinkedList<int>) {
+    TestType list;
+    for (int i = 0; i < 5; ++i) list.push_back(i);
+
+    auto it = list.end();
+    --it;
+    REQUIRE(*it == 4);
+    it--;
+    REQUIRE(*it == 3);
+    ++it;
+    REQUIRE(*it == 4);
+
+    for (int& v : list) v *= 10;
+    REQUIRE(forward(list) == std::vector<int>{0, 10, 20, 30, 40});
+
+    typename TestType::const_iterator cit = list.begin();
+    REQUIRE(*cit == 0);
+    REQUIRE(std::distance(list.cbegin(), list.cend()) == 5);
+}
+
+TEMPLATE_TEST_CASE("copy and move", "[constructor]", DoublyLinkedList<int>, XorLinkedList<int>) {
+    TestType list;
+    for (int i = 0; i < 4; ++i) list.push_back(i);
+
+    TestType copy(list);
+    REQUIRE(copy == list);
+
+    TestType moved(std::move(copy));
+    REQUIRE(moved == list);
+    REQUIRE(copy.empty());
+    moved.push_front(-1);
+    moved.push_back(4);
+    REQUIRE(backward(moved) == std::vector<int>{4, 3, 2, 1, 0, -1});
+
+    copy = std::move(moved);
+    REQUIRE(copy.size() == 6);
+    REQUIRE(moved.empty());
+    moved.push_back(1);
+    REQUIRE(moved.back() == 1);
+
+    list = copy;
+    REQUIRE(list == copy);
+    list.clear();
+    REQUIRE(list.empty());
+    REQUIRE(list.begin() == list.end());
+}
+
+TEST_CASE("xor links use one word per link", "[memory]") {
+    // The sentinels are bare links, so the list objects show the link width
+    REQUIRE(sizeof(DoublyLinkedList<std::uint64_t>) == 5 * sizeof(void*));
+    REQUIRE(sizeof(XorLinkedList<std::uint64_t>) == 3 * sizeof(void*));
+}
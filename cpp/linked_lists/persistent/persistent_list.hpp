@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+
+#include "epoch.hpp"
+
+template <typename T>
+class AtomicPersistentList;
+
+// Immutable singly linked list. Versions share their tails: every node is
+// reference counted, so push_front and pop_front are O(1) and never touch
+// the list they start from.
+template <typename T>
+class PersistentList {
+private:
+    struct Node {
+        T value;
+        Node* next;
+        std::size_t size;
+        std::atomic<std::size_t> refs{1};
+
+        Node(const T& v, Node* n) : value(v), next(n), size(n ? n->size + 1 : 1) {}
+        Node(T&& v, Node* n) : value(std::move(v)), next(n), size(n ? n->size + 1 : 1) {}
+    };
+
+    Node* head_ = nullptr;
+
+    // Adopts one reference to head
+    explicit PersistentList(Node* head) noexcept;
+
+    static Node* retain(Node* node) noexcept;
+    static void release(Node* node) noexcept;
+
+    friend class AtomicPersistentList<T>;
+public:
+    class const_iterator {
+    private:
+        const Node* current_;
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        explicit const_iterator(const Node* node = nullptr) noexcept : current_(node) {}
+
+        const T& operator*() const { return current_->value; }
+        const T* operator->() const { return &current_->value; }
+
+        const_iterator& operator++() {
+            current_ = current_->next;
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        friend bool operator==(const const_iterator& a, const const_iterator& b) { return a.current_ == b.current_; }
+    };
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cbegin() const noexcept;
+    const_iterator cend() const noexcept;
+
+    PersistentList() noexcept = default;
+    PersistentList(std::initializer_list<T> values);
+    PersistentList(const PersistentList& other) noexcept;
+    PersistentList(PersistentList&& other) noexcept;
+
+    ~PersistentList() noexcept;
+
+    PersistentList& operator=(const PersistentList& other) noexcept;
+    PersistentList& operator=(PersistentList&& other) noexcept;
+
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+
+    const T& front() const;
+
+    [[nodiscard]] PersistentList push_front(const T& value) const;
+    [[nodiscard]] PersistentList push_front(T&& value) const;
+    [[nodiscard]] PersistentList pop_front() const;
+
+    // True when both versions share their first node
+    bool same_as(const PersistentList& other) const noexcept;
+
+    bool operator==(const PersistentList& other) const;
+};
+
+template <typename T>
+PersistentList<T> cons(const T& value, const PersistentList<T>& list);
+
+// Publication point for a PersistentList. Readers take a reference to the
+// current version without locking: they pin the global EpochDomain while
+// doing so, and the reference dropped by a replaced version is only
+// released after every such reader has moved on.
+template <typename T>
+class AtomicPersistentList {
+private:
+    using Node = typename PersistentList<T>::Node;
+
+    std::atomic<Node*> head_{nullptr};
+
+    static void releaseRetired(void* node) noexcept;
+public:
+    AtomicPersistentList() noexcept = default;
+    explicit AtomicPersistentList(PersistentList<T> list) noexcept;
+    AtomicPersistentList(const AtomicPersistentList&) = delete;
+    AtomicPersistentList& operator=(const AtomicPersistentList&) = delete;
+
+    ~AtomicPersistentList() noexcept;
+
+    PersistentList<T> load() const;
+    void store(PersistentList<T> list);
+    PersistentList<T> exchange(PersistentList<T> list);
+
+    // Retries f(current) until it is published on top of the version it saw
+    template <class F>
+    void update(F f);
+};
+
+#include "persistent_list.inl"
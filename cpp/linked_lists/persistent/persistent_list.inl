@@ -0,0 +1,220 @@
+#include "persistent_list.hpp"
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// ### Reference counting ###
+
+template <typename T>
+PersistentList<T>::PersistentList(Node* head) noexcept : head_(head) {}
+
+template <typename T>
+typename PersistentList<T>::Node* PersistentList<T>::retain(Node* node) noexcept {
+    if (node) node->refs.fetch_add(1, std::memory_order_relaxed);
+    return node;
+}
+
+template <typename T>
+void PersistentList<T>::release(Node* node) noexcept {
+    // Iterative, so dropping the last version of a long list cannot overflow
+    // the stack
+    while (node && node->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        Node* next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+// ### Iteration ###
+
+template <typename T>
+typename PersistentList<T>::const_iterator PersistentList<T>::begin() const noexcept {
+    return const_iterator(head_);
+}
+
+template <typename T>
+typename PersistentList<T>::const_iterator PersistentList<T>::end() const noexcept {
+    return const_iterator(nullptr);
+}
+
+template <typename T>
+typename PersistentList<T>::const_iterator PersistentList<T>::cbegin() const noexcept {
+    return begin();
+}
+
+template <typename T>
+typename PersistentList<T>::const_iterator PersistentList<T>::cend() const noexcept {
+    return end();
+}
+
+// ### Constructors ###
+
+template <typename T>
+PersistentList<T>::PersistentList(std::initializer_list<T> values) {
+    std::vector<const T*> order;
+    order.reserve(values.size());
+    for (const T& value : values) order.push_back(&value);
+
+    try {
+        for (auto it = order.rbegin(); it != order.rend(); ++it) head_ = new Node(**it, head_);
+    } catch (...) {
+        release(head_);
+        throw;
+    }
+}
+
+template <typename T>
+PersistentList<T>::PersistentList(const PersistentList& other) noexcept : head_(retain(other.head_)) {}
+
+template <typename T>
+PersistentList<T>::PersistentList(PersistentList&& other) noexcept : head_(std::exchange(other.head_, nullptr)) {}
+
+// ### Destructor ###
+
+template <typename T>
+PersistentList<T>::~PersistentList() noexcept {
+    release(head_);
+}
+
+// ### = operator ###
+
+template <typename T>
+PersistentList<T>& PersistentList<T>::operator=(const PersistentList& other) noexcept {
+    Node* head = retain(other.head_);
+    release(head_);
+    head_ = head;
+    return *this;
+}
+
+template <typename T>
+PersistentList<T>& PersistentList<T>::operator=(PersistentList&& other) noexcept {
+    if (this != &other) {
+        release(head_);
+        head_ = std::exchange(other.head_, nullptr);
+    }
+    return *this;
+}
+
+// ### Capacity methods ###
+
+template <typename T>
+std::size_t PersistentList<T>::size() const noexcept {
+    return head_ ? head_->size : 0;
+}
+
+template <typename T>
+bool PersistentList<T>::empty() const noexcept {
+    return head_ == nullptr;
+}
+
+// ### Element access methods ###
+
+template <typename T>
+const T& PersistentList<T>::front() const {
+    if (empty()) throw std::out_of_range("front on empty list");
+    return head_->value;
+}
+
+// ### Versioning methods ###
+
+template <typename T>
+PersistentList<T> PersistentList<T>::push_front(const T& value) const {
+    Node* node = new Node(value, head_);
+    retain(head_);
+    return PersistentList(node);
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::push_front(T&& value) const {
+    Node* node = new Node(std::move(value), head_);
+    retain(head_);
+    return PersistentList(node);
+}
+
+template <typename T>
+PersistentList<T> PersistentList<T>::pop_front() const {
+    if (empty()) throw std::out_of_range("pop_front on empty list");
+    return PersistentList(retain(head_->next));
+}
+
+template <typename T>
+bool PersistentList<T>::same_as(const PersistentList& other) const noexcept {
+    return head_ == other.head_;
+}
+
+template <typename T>
+bool PersistentList<T>::operator==(const PersistentList& other) const {
+    if (size() != other.size()) return false;
+
+    // Shared tails compare equal without walking them
+    const Node* a = head_;
+    const Node* b = other.head_;
+    for (; a != b; a = a->next, b = b->next) {
+        if (!(a->value == b->value)) return false;
+    }
+    return true;
+}
+
+template <typename T>
+PersistentList<T> cons(const T& value, const PersistentList<T>& list) {
+    return list.push_front(value);
+}
+
+// ### Publication ###
+
+template <typename T>
+AtomicPersistentList<T>::AtomicPersistentList(PersistentList<T> list) noexcept
+    : head_(std::exchange(list.head_, nullptr)) {}
+
+template <typename T>
+AtomicPersistentList<T>::~AtomicPersistentList() noexcept {
+    PersistentList<T>::release(head_.load(std::memory_order_acquire));
+}
+
+template <typename T>
+void AtomicPersistentList<T>::releaseRetired(void* node) noexcept {
+    PersistentList<T>::release(static_cast<Node*>(node));
+}
+
+template <typename T>
+PersistentList<T> AtomicPersistentList<T>::load() const {
+    // The pin keeps the published head alive between reading it and
+    // taking a reference
+    auto guard = EpochDomain::global().pin();
+    return PersistentList<T>(PersistentList<T>::retain(head_.load(std::memory_order_acquire)));
+}
+
+template <typename T>
+void AtomicPersistentList<T>::store(PersistentList<T> list) {
+    exchange(std::move(list));
+}
+
+template <typename T>
+PersistentList<T> AtomicPersistentList<T>::exchange(PersistentList<T> list) {
+    auto guard = EpochDomain::global().pin();
+    Node* old = head_.exchange(std::exchange(list.head_, nullptr), std::memory_order_acq_rel);
+
+    // Hand back a reference of our own and defer dropping the published one
+    PersistentList<T> previous(PersistentList<T>::retain(old));
+    if (old) EpochDomain::global().retire(old, &releaseRetired);
+    return previous;
+}
+
+template <typename T>
+template <class F>
+void AtomicPersistentList<T>::update(F f) {
+    auto guard = EpochDomain::global().pin();
+
+    while (true) {
+        PersistentList<T> current = load();
+        PersistentList<T> next = f(current);
+
+        Node* expected = current.head_;
+        if (head_.compare_exchange_strong(expected, next.head_, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            next.head_ = nullptr;
+            if (expected) EpochDomain::global().retire(expected, &releaseRetired);
+            return;
+        }
+    }
+}
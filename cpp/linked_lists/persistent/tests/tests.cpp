@@ -0,0 +1,116 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../persistent_list.hpp"
+
+TEST_CASE("Default construction", "[constructor]") {
+    PersistentList<int> list;
+
+    REQUIRE(list.size() == 0);
+    REQUIRE(list.empty());
+    REQUIRE(list.begin() == list.end());
+    REQUIRE_THROWS_AS(list.front(), std::out_of_range);
+    REQUIRE_THROWS_AS(list.pop_front(), std::out_of_range);
+}
+
+TEST_CASE("initializer list keeps order", "[constructor]") {
+    PersistentList<std::string> list{"a", "b", "c"};
+
+    REQUIRE(list.size() == 3);
+    REQUIRE(list.front() == "a");
+    REQUIRE(std::vector<std::string>(list.begin(), list.end()) == std::vector<std::string>{"a", "b", "c"});
+}
+
+TEST_CASE("new versions leave the old one untouched", "[versions]") {
+    PersistentList<int> base{2, 3};
+    auto pushed = base.push_front(1);
+    auto consed = cons(0, pushed);
+    auto popped = base.pop_front();
+
+    REQUIRE(std::vector<int>(base.begin(), base.end()) == std::vector<int>{2, 3});
+    REQUIRE(std::vector<int>(pushed.begin(), pushed.end()) == std::vector<int>{1, 2, 3});
+    REQUIRE(std::vector<int>(consed.begin(), consed.end()) == std::vector<int>{0, 1, 2, 3});
+    REQUIRE(std::vector<int>(popped.begin(), popped.end()) == std::vector<int>{3});
+    REQUIRE(consed.size() == 4);
+    REQUIRE(popped.size() == 1);
+}
+
+TEST_CASE("versions share their tails", "[versions]") {
+    PersistentList<int> base{1, 2, 3};
+    auto pushed = base.push_front(0);
+
+    REQUIRE(&*std::next(pushed.begin()) == &*base.begin());
+    REQUIRE(pushed.pop_front().same_as(base));
+    REQUIRE(pushed.pop_front() == base);
+    REQUIRE_FALSE(pushed == base);
+    REQUIRE(PersistentList<int>{1, 2, 3} == base);
+}
+
+TEST_CASE("dropping the last version of a long list", "[memory]") {
+    PersistentList<int> list;
+    for (int i = 0; i < 1'000'000; ++i) list = list.push_front(i);
+    REQUIRE(list.size() == 1'000'000);
+
+    auto tail = list;
+    for (int i = 0; i < 10; ++i) tail = tail.pop_front();
+    list = PersistentList<int>();
+    REQUIRE(tail.front() == 999'989);
+}
+
+TEST_CASE("published versions are loaded and replaced", "[publish]") {
+    AtomicPersistentList<int> published(PersistentList<int>{1});
+
+    auto first = published.load();
+    published.store(first.push_front(0));
+    REQUIRE(published.load().size() == 2);
+    REQUIRE(first.size() == 1);
+
+    auto previous = published.exchange(PersistentList<int>{});
+    REQUIRE(previous.front() == 0);
+    REQUIRE(published.load().empty());
+
+    published.update([](const PersistentList<int>& current) { return current.push_front(7); });
+    REQUIRE(published.load().front() == 7);
+}
+
+TEST_CASE("readers never observe a torn version", "[publish][concurrent]") {
+    AtomicPersistentList<int> published;
+    std::atomic<bool> done{false};
+    std::atomic<bool> torn{false};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                // Every version is a countdown from size - 1 to 0
+                auto version = published.load();
+                int expected = static_cast<int>(version.size()) - 1;
+                for (int v : version) {
+                    if (v != expected--) torn = true;
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 2; ++w) {
+        writers.emplace_back([&] {
+            for (int i = 0; i < 2000; ++i) {
+                published.update([](const PersistentList<int>& current) {
+                    if (current.size() > 50) return PersistentList<int>();
+                    return current.push_front(static_cast<int>(current.size()));
+                });
+            }
+        });
+    }
+    for (auto& writer : writers) writer.join();
+    done = true;
+    for (auto& reader : readers) reader.join();
+
+    REQUIRE_FALSE(torn);
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <ranges>
+
+#include "list.hpp"
+
+inline constexpr std::size_t defaultFindGroup = 8;
+
+// Batched lookup: out[i] points at the first element of *lists[i] equal to
+// keys[i], or is nullptr when there is none. Up to `group` traversals run
+// interleaved (AMAC style); each step prefetches that lookup's next node and
+// moves on to the next lookup, so the cache misses of independent walks
+// overlap instead of serializing.
+template <std::ranges::random_access_range Lists, std::ranges::random_access_range Keys, std::ranges::random_access_range Out>
+void find_many(const Lists& lists, const Keys& keys, Out&& out, std::size_t group = defaultFindGroup);
+
+#include "find_many.inl"
@@ -0,0 +1,66 @@
+#include "find_many.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+template <std::ranges::random_access_range Lists, std::ranges::random_access_range Keys, std::ranges::random_access_range Out>
+void find_many(const Lists& lists, const Keys& keys, Out&& out, std::size_t group) {
+    using List = std::remove_cvref_t<decltype(*std::ranges::begin(lists)[0])>;
+    using Iterator = typename List::const_iterator;
+
+    struct Lookup {
+        Iterator curr;
+        Iterator end;
+        std::size_t index;
+    };
+
+    std::size_t count = std::ranges::size(keys);
+    if (std::ranges::size(lists) != count || std::ranges::size(out) != count) {
+        throw std::invalid_argument("find_many ranges differ in size");
+    }
+    if (count == 0) return;
+
+    auto listAt = std::ranges::begin(lists);
+    auto keyAt = std::ranges::begin(keys);
+    auto outAt = std::ranges::begin(out);
+
+    std::size_t next = 0;
+    auto start = [&](Lookup& lookup) {
+        const List& list = *listAt[next];
+        lookup = Lookup{list.cbegin(), list.cend(), next++};
+        if (lookup.curr != lookup.end) __builtin_prefetch(std::addressof(*lookup.curr));
+    };
+
+    std::vector<Lookup> inFlight(std::min(std::max<std::size_t>(group, 1), count));
+    for (Lookup& lookup : inFlight) start(lookup);
+
+    std::size_t active = inFlight.size();
+    while (active > 0) {
+        for (std::size_t i = 0; i < active; ) {
+            Lookup& lookup = inFlight[i];
+
+            bool done = true;
+            if (lookup.curr == lookup.end) {
+                outAt[lookup.index] = nullptr;
+            } else if (*lookup.curr == keyAt[lookup.index]) {
+                outAt[lookup.index] = std::addressof(*lookup.curr);
+            } else {
+                ++lookup.curr;
+                if (lookup.curr != lookup.end) __builtin_prefetch(std::addressof(*lookup.curr));
+                done = false;
+            }
+
+            if (!done) {
+                i++;
+            } else if (next < count) {
+                start(lookup);
+                i++;
+            } else {
+                lookup = inFlight[--active];
+            }
+        }
+    }
+}
@@ -1,39 +1,159 @@
 #pragma once
 
+#include <concepts>
 #include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
-template <typename T>
+#include "stats.hpp"
+
+// How set operations skip over runs of the other input. Galloping uses an
+// exponential then binary search, which needs random access: it applies
+// only while a list still sits in its compact()/load() block in order, and
+// falls back to a linear walk otherwise.
+enum class SetMode { linear, galloping };
+
+// What clear() and the destructor do with the nodes they drop. Either way
+// the chain is detached in O(1); immediate frees it on the spot, deferred
+// keeps it until reclaim() is called (the destructor hands it to the
+// background reclaimer instead), background always hands it over.
+enum class ReclaimMode { immediate, deferred, background };
+
+// How sort() orders the list. automatic picks radix for integral and
+// floating-point T whose keys differ in at most four bytes, pointer_array
+// for other lists past a small size, and merge below that. radix and merge
+// are stable; pointer_array is not.
+enum class SortStrategy { automatic, merge, pointer_array, radix };
+
+// Keys an LSD radix sort can order by their bit patterns
+template <typename K>
+concept RadixKey = (std::integral<K> && !std::same_as<K, bool>)
+    || (std::floating_point<K> && (sizeof(K) == 4 || sizeof(K) == 8));
+
+template <typename T, typename Stats = NoStats>
 class SinglyLinkedList {
 private:
-    struct Node {
-        T value;
+    struct Node;
+
+    // The part of a node the chain walks through. The list's head is a bare
+    // Link, so an empty list holds no node and T needs no default value.
+    struct Link {
         Node* next = nullptr;
+    };
+
+    struct Node : Link {
+        T value;
 
-        explicit Node(const T& v, Node* n = nullptr) : value(v), next(n) {}
+        explicit Node(const T& v, Node* n = nullptr) : Link{n}, value(v) {}
+        explicit Node(T&& v, Node* n = nullptr) : Link{n}, value(std::move(v)) {}
 
         bool operator<(const Node& other) const {
             return this->value < other.value;
         }
     };
 
-    Node* sentinel_ = nullptr;
-    Node* tail_ = nullptr;
+    // Released slots of block_ are threaded through their own storage.
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    // Nodes dropped by clear(), together with the block some of them live in
+    struct Detached {
+        Node* head;
+        Node* block;
+        std::size_t blockCapacity;
+        std::size_t heapNodes;
+        std::size_t count;
+        Detached* next = nullptr;
+    };
+
+    // Const members hand out non-const access, as the list always has
+    mutable Link head_;
+    Link* tail_ = &head_;
     std::size_t size_ = 0;
 
+    // Contiguous node storage built by compact()
+    Node* block_ = nullptr;
+    std::size_t blockCapacity_ = 0;
+    FreeSlot* freeList_ = nullptr;
+
+    double compactThreshold_ = 1.0;
+
+    // block_[0, blockCapacity_) holds the whole list in order
+    bool blockOrdered_ = false;
+
+    // Nodes allocated one by one rather than taken from block_
+    std::size_t heapNodes_ = 0;
+
+    ReclaimMode reclaimMode_ = ReclaimMode::immediate;
+    Detached* pending_ = nullptr;
+    Detached* pendingTail_ = nullptr;
+    std::size_t pendingNodes_ = 0;
+
+    // First node of each segment handed to a parallel worker
+    std::vector<Node*> segments_;
+    bool segmentsStale_ = true;
+
+    [[no_unique_address]] mutable Stats stats_;
+
+    // Node allocation helpers
+    Node* createNode(const T& value, Node* next = nullptr);
+    void destroyNode(Node* node);
+    bool inBlock(const Node* node) const noexcept;
+    void releaseBlock() noexcept;
+    void destroyChain(Node* head);
+    void compactIfFragmented();
+
+    // Set operation helpers
+    Link* skipBefore(Link* prev, const T& key, SetMode mode) const;
+    Node* takeFront(SinglyLinkedList& other);
+
+    // Reclamation helpers
+    Detached detach() noexcept;
+    static bool freeNodes(Detached& detached, std::size_t budget);
+    static bool reclaimStep(void* detached, std::size_t budget);
+
     // Sort helpers
+    static constexpr std::size_t pointerSortThreshold = 64;
+    static constexpr std::size_t automaticRadixPasses = 4;
+
+    // Returns false, leaving the list untouched, if more passes are needed
+    template <class KeyFn>
+    bool radixSort(KeyFn key, std::size_t maxPasses = static_cast<std::size_t>(-1));
+    void pointerSort();
     Node* sortList(Node* head);
     Node* merge(Node* head1, Node* head2);
     Node* findMiddle(Node* head);
+
+    // Parallel algorithm helpers
+    static constexpr std::size_t segmentTarget = 256;
+    static constexpr std::size_t minSegmentLength = 1024;
+
+    void buildSegments(std::vector<Node*>& segments) const;
+    const std::vector<Node*>& refreshSegments();
+    template <class Fn>
+    void forEachSegment(const std::vector<Node*>& segments, Fn fn, std::size_t threads) const;
 public:
     class iterator {
     private:
-        Node* current_;
+        Link* current_;
         friend class const_iterator;
+        friend class SinglyLinkedList;
     public:
-        explicit iterator(Node* node = nullptr) noexcept : current_(node) {}
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        explicit iterator(Link* node = nullptr) noexcept : current_(node) {}
 
-        T& operator*() const { return current_->value; }
-        T& operator->() const { return &current_->value; }
+        T& operator*() const { return static_cast<Node*>(current_)->value; }
+        T* operator->() const { return &static_cast<Node*>(current_)->value; }
 
         iterator& operator++() {
             current_ = current_->next;
@@ -41,24 +161,30 @@ public:
         }
 
         iterator operator++(int) {
-            iterator tmp(this);
-            (*this)++;
+            iterator tmp(*this);
+            ++*this;
             return tmp;
         }
 
         friend bool operator==(const iterator& a, const iterator& b) { return a.current_ == b.current_; }
-        friend bool operator!=(const iterator& a, const iterator& b) { return a.current_ != b.current_; }
     };
 
     class const_iterator {
     private:
-        const Node* current_;
+        const Link* current_;
+        friend class SinglyLinkedList;
     public:
-        explicit const_iterator(const Node* node = nullptr) noexcept : current_(node) {}
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        explicit const_iterator(const Link* node = nullptr) noexcept : current_(node) {}
         const_iterator(const iterator& it) noexcept : current_(it.current_) {}
 
-        T& operator*() const { return current_->value; }
-        T* operator->() const { return &current_->value; }
+        const T& operator*() const { return static_cast<const Node*>(current_)->value; }
+        const T* operator->() const { return &static_cast<const Node*>(current_)->value; }
 
         const_iterator& operator++() {
             current_ = current_->next;
@@ -66,26 +192,29 @@ public:
         }
 
         const_iterator operator++(int) {
-            const_iterator tmp(this);
-            (*this)++;
+            const_iterator tmp(*this);
+            ++*this;
             return tmp;
         }
 
         friend bool operator==(const const_iterator& a, const const_iterator& b) { return a.current_ == b.current_; }
-        friend bool operator!=(const const_iterator& a, const const_iterator& b) { return a.current_ != b.current_; }
     };
 
-    iterator begin() const noexcept;
-    iterator end() const noexcept;
+    iterator before_begin() const noexcept;
+    const_iterator cbefore_begin() const noexcept;
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
     const_iterator cbegin() const noexcept;
     const_iterator cend() const noexcept;
 
-    SinglyLinkedList() = default;
+    SinglyLinkedList();
     SinglyLinkedList(const SinglyLinkedList& other);
     SinglyLinkedList(SinglyLinkedList&& other) noexcept;
 
     ~SinglyLinkedList() noexcept;
-    
+
     SinglyLinkedList& operator=(SinglyLinkedList& other);
     SinglyLinkedList& operator=(SinglyLinkedList&& other);
 
@@ -104,11 +233,83 @@ public:
     void push_back(const T& value);
     void insert(const T& value, std::size_t pos);
 
-    T& pop_front();
-    T& pop_back();
-    T& erase(std::size_t pos);
+    T pop_front();
+    T pop_back();
+    T erase(std::size_t pos);
+
+    // Single-pass removal; unlinked nodes are freed together after the pass
+    template <class Pred>
+    std::size_t remove_if(Pred pred);
+    std::size_t remove(const T& value);
+    std::size_t unique();
+
+    iterator erase_after(const_iterator pos);
+    iterator erase_after(const_iterator first, const_iterator last);
+    iterator erase(const_iterator first, const_iterator last);
 
     void clear();
 
-    void sort();
+    void sort(SortStrategy strategy = SortStrategy::automatic);
+
+    // Stable radix sort on an integral or floating-point key of each element
+    template <class KeyFn>
+        requires RadixKey<std::decay_t<std::invoke_result_t<KeyFn&, const T&>>>
+    void sort(KeyFn key);
+
+    // Set operations on sorted lists, with std::set_* multiset semantics
+    SinglyLinkedList set_union(const SinglyLinkedList& other, SetMode mode = SetMode::linear) const;
+    SinglyLinkedList set_intersection(const SinglyLinkedList& other, SetMode mode = SetMode::linear) const;
+    SinglyLinkedList set_difference(const SinglyLinkedList& other, SetMode mode = SetMode::linear) const;
+    bool includes(const SinglyLinkedList& other, SetMode mode = SetMode::linear) const;
+
+    // Destructive variants: the result is built in *this by relinking the
+    // nodes of both lists, and other is left empty.
+    void set_union_in_place(SinglyLinkedList& other, SetMode mode = SetMode::linear);
+    void set_intersection_in_place(SinglyLinkedList& other);
+    void set_difference_in_place(SinglyLinkedList& other, SetMode mode = SetMode::linear);
+
+    // Memory layout
+    void compact();
+    double fragmentation() const noexcept;
+    void set_compact_threshold(double threshold) noexcept;
+
+    // Parallel algorithms: workers claim whole segments of the list through
+    // a segment index that is rebuilt in one pass on the first call after a
+    // mutation. parallel_reduce only reads that index, building a private
+    // one when it is stale, so concurrent const calls are safe. threads == 0
+    // uses every hardware thread. reduce must be associative; partial
+    // results are combined in list order.
+    template <class F>
+    void parallel_for_each(F f, std::size_t threads = 0);
+    template <class F>
+    void parallel_transform(F f, std::size_t threads = 0);
+    template <class U, class Reduce, class Map = std::identity>
+    U parallel_reduce(U init, Reduce reduce, Map map = {}, std::size_t threads = 0) const;
+
+    // Reclamation
+    void set_reclaim_mode(ReclaimMode mode) noexcept;
+    std::size_t reclaim(std::size_t budget = static_cast<std::size_t>(-1));
+    std::size_t pending_reclaim() const noexcept;
+
+    // Instrumentation
+    ContainerStats stats() const noexcept;
+    void reset_stats() noexcept;
+
+    // Snapshots
+    void save(const std::string& path) const requires std::is_trivially_copyable_v<T>;
+    static SinglyLinkedList load(const std::string& path) requires std::is_trivially_copyable_v<T>;
 };
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats> set_union(const SinglyLinkedList<T, Stats>& a, const SinglyLinkedList<T, Stats>& b, SetMode mode = SetMode::linear);
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats> set_intersection(const SinglyLinkedList<T, Stats>& a, const SinglyLinkedList<T, Stats>& b, SetMode mode = SetMode::linear);
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats> set_difference(const SinglyLinkedList<T, Stats>& a, const SinglyLinkedList<T, Stats>& b, SetMode mode = SetMode::linear);
+
+template <typename T, typename Stats>
+bool includes(const SinglyLinkedList<T, Stats>& a, const SinglyLinkedList<T, Stats>& b, SetMode mode = SetMode::linear);
+
+#include "list.inl"
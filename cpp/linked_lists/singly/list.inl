@@ -1,215 +1,332 @@
 #include "list.hpp"
+#include "reclaimer.hpp"
+#include "snapshot.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 // ### Iteration ###
 
-template <typename T>
-SinglyLinkedList<T>::iterator
-SinglyLinkedList<T>::begin() const noexcept {
-    return iterator(sentinel_);
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::iterator
+SinglyLinkedList<T, Stats>::before_begin() const noexcept {
+    return iterator(&head_);
 }
 
-template <typename T>
-SinglyLinkedList<T>::iterator
-SinglyLinkedList<T>::end() const noexcept {
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::const_iterator
+SinglyLinkedList<T, Stats>::cbefore_begin() const noexcept {
+    return const_iterator(&head_);
+}
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::iterator
+SinglyLinkedList<T, Stats>::begin() noexcept {
+    return iterator(head_.next);
+}
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::iterator
+SinglyLinkedList<T, Stats>::end() noexcept {
     return iterator(nullptr);
 }
 
-template <typename T>
-SinglyLinkedList<T>::const_iterator
-SinglyLinkedList<T>::cbegin() const noexcept {
-    return const_iterator(sentinel_);
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::const_iterator
+SinglyLinkedList<T, Stats>::begin() const noexcept {
+    return const_iterator(head_.next);
+}
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::const_iterator
+SinglyLinkedList<T, Stats>::end() const noexcept {
+    return const_iterator(nullptr);
 }
 
-template <typename T>
-SinglyLinkedList<T>::const_iterator
-SinglyLinkedList<T>::cend() const noexcept {
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::const_iterator
+SinglyLinkedList<T, Stats>::cbegin() const noexcept {
+    return const_iterator(head_.next);
+}
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::const_iterator
+SinglyLinkedList<T, Stats>::cend() const noexcept {
     return const_iterator(nullptr);
 }
 
 // ### Constructors ###
 
-template <typename T>
-SinglyLinkedList<T>::SinglyLinkedList(const SinglyLinkedList& other) {
-    for (Node* n = other.sentinel_; n; n = n->next) {
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::SinglyLinkedList() = default;
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::SinglyLinkedList(const SinglyLinkedList& other) : SinglyLinkedList() {
+    for (Node* n = other.head_.next; n; n = n->next) {
         this->push_back(n->value);
     }
 }
 
-template <typename T>
-SinglyLinkedList<T>::SinglyLinkedList(SinglyLinkedList&& other) noexcept : sentinel_(other.sentinel_), tail_(other.tail_), size_(other.size_) {
-    other.sentinel_ = nullptr;
-    other.tail_ = nullptr;
-    other.size_ = 0;
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::SinglyLinkedList(SinglyLinkedList&& other) noexcept : SinglyLinkedList() {
+    *this = std::move(other);
 }
 
 // ### Destructor ###
 
-template <typename T>
-SinglyLinkedList<T>::~SinglyLinkedList() noexcept { clear(); }
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::~SinglyLinkedList() noexcept {
+    clear();
+
+    // Deferred chains must outlive the list
+    while (pending_) {
+        Detached* next = pending_->next;
+        try {
+            NodeReclaimer::global().submit(pending_, &reclaimStep);
+        } catch (...) {
+            reclaimStep(pending_, static_cast<std::size_t>(-1));
+        }
+        pending_ = next;
+    }
+}
 
 // ### = operator ###
 
-template <typename T>
-SinglyLinkedList<T>& SinglyLinkedList<T>::operator=(SinglyLinkedList& other) {
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>& SinglyLinkedList<T, Stats>::operator=(SinglyLinkedList& other) {
     if (this != &other) {
         this->clear();
-        for (Node* n = other.sentinel_; n; n = n->next) this->push_back(n->value);
+        for (Node* n = other.head_.next; n; n = n->next) this->push_back(n->value);
     }
     return *this;
 }
 
-template <typename T>
-SinglyLinkedList<T>& SinglyLinkedList<T>::operator=(SinglyLinkedList&& other) {
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>& SinglyLinkedList<T, Stats>::operator=(SinglyLinkedList&& other) {
     if (this != &other) {
         clear();
-        this->sentinel_ = other.sentinel_;
-        this->tail_ = other.tail_;
+        this->head_.next = other.head_.next;
+        this->tail_ = other.empty() ? &this->head_ : other.tail_;
         this->size_ = other.size_;
+        this->block_ = other.block_;
+        this->blockCapacity_ = other.blockCapacity_;
+        this->freeList_ = other.freeList_;
+        this->blockOrdered_ = other.blockOrdered_;
+        this->heapNodes_ = other.heapNodes_;
+        this->segmentsStale_ = true;
 
-        other.sentinel_ = nullptr;
-        other.tail_ = nullptr;
+        other.head_.next = nullptr;
+        other.tail_ = &other.head_;
         other.size_ = 0;
+        other.block_ = nullptr;
+        other.blockCapacity_ = 0;
+        other.freeList_ = nullptr;
+        other.blockOrdered_ = false;
+        other.heapNodes_ = 0;
+        other.segmentsStale_ = true;
     }
     return *this;
 }
 
 // ### Capacity methods ###
 
-template <typename T>
-std::size_t SinglyLinkedList<T>::size() const noexcept { return size_; }
+template <typename T, typename Stats>
+std::size_t SinglyLinkedList<T, Stats>::size() const noexcept { return size_; }
 
-template <typename T>
-bool SinglyLinkedList<T>::empty() const noexcept { return size_ == 0; }
+template <typename T, typename Stats>
+bool SinglyLinkedList<T, Stats>::empty() const noexcept { return size_ == 0; }
 
 // ### Element access methods ###
 
-template <typename T>
-T& SinglyLinkedList<T>::front() const {
-    if (empty()) throw std::out_of_range("front on empty list");
-    return sentinel_->value;
+template <typename T, typename Stats>
+T& SinglyLinkedList<T, Stats>::front() const {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::access);
+    if (empty()) {
+        stats_.record_exception(Operation::access);
+        throw std::out_of_range("front on empty list");
+    }
+    return head_.next->value;
 }
 
-template <typename T>
-T& SinglyLinkedList<T>::back() const {
-    if (empty()) throw std::out_of_range("back on empty list");
-    return tail_->value;
+template <typename T, typename Stats>
+T& SinglyLinkedList<T, Stats>::back() const {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::access);
+    if (empty()) {
+        stats_.record_exception(Operation::access);
+        throw std::out_of_range("back on empty list");
+    }
+    return static_cast<Node*>(tail_)->value;
 }
 
-template <typename T>
-T& SinglyLinkedList<T>::at(std::size_t pos) const {
-    if (pos >= size_) throw std::out_of_range("at pos out of range");
-    
-    if (pos == 0) return front();
-    else if (pos == size_-1) return back();
-    else {
-        Node* curr = sentinel_;
+template <typename T, typename Stats>
+T& SinglyLinkedList<T, Stats>::at(std::size_t pos) const {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::at);
+    if (pos >= size_) {
+        stats_.record_exception(Operation::at);
+        throw std::out_of_range("at pos out of range");
+    }
+
+    if (pos == size_-1) {
+        stats_.record_visits(Operation::at, 1);
+        return static_cast<Node*>(tail_)->value;
+    } else {
+        stats_.record_visits(Operation::at, pos + 1);
+        Node* curr = head_.next;
         while (pos--) curr = curr->next;
         return curr->value;
     }
 }
 
-template <typename T>
-T& SinglyLinkedList<T>::operator[](std::size_t pos) const {
-    if (pos > size()) throw std::out_of_range("[pos] out of range");
-    
-    if (pos == 0) return front();
-    else if (pos == size_-1) return back();
-    else {
-        Node* curr = sentinel_;
+template <typename T, typename Stats>
+T& SinglyLinkedList<T, Stats>::operator[](std::size_t pos) const {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::at);
+    if (pos >= size()) {
+        stats_.record_exception(Operation::at);
+        throw std::out_of_range("[pos] out of range");
+    }
+
+    if (pos == size_-1) {
+        stats_.record_visits(Operation::at, 1);
+        return static_cast<Node*>(tail_)->value;
+    } else {
+        stats_.record_visits(Operation::at, pos + 1);
+        Node* curr = head_.next;
         while (pos--) curr = curr->next;
         return curr->value;
     }
 }
 
-template <typename T>
-SinglyLinkedList<T>::Node* SinglyLinkedList<T>::find(const T& value) const {
-    for (Node* curr = sentinel_; curr; curr = curr->next) {
-        if (curr->value == value) return curr;
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::Node* SinglyLinkedList<T, Stats>::find(const T& value) const {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::find);
+
+    std::size_t visited = 0;
+    for (Node* curr = head_.next; curr; curr = curr->next) {
+        visited++;
+        if (curr->value == value) {
+            stats_.record_visits(Operation::find, visited);
+            return curr;
+        }
     }
+    stats_.record_visits(Operation::find, visited);
     return nullptr;
 }
 
 // ### Modifier methods ###
 
-template <typename T>
-void SinglyLinkedList<T>::push_front(const T& value) {
-    sentinel_->next = new Node(value, sentinel_->next);
-    if (size_ == 0) tail_ = sentinel_->next;
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::push_front(const T& value) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::push);
+    head_.next = createNode(value, head_.next);
+    if (size_ == 0) tail_ = head_.next;
     size_++;
+    stats_.record_size(size_);
 }
 
-template <typename T>
-void SinglyLinkedList<T>::push_back(const T& value) {
-    tail_->next = new Node(value);
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::push_back(const T& value) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::push);
+    tail_->next = createNode(value);
     tail_ = tail_->next;
     size_++;
+    stats_.record_size(size_);
 }
 
-template <typename T>
-void SinglyLinkedList<T>::insert(const T& value, std::size_t pos) {
-    if (pos >= size()) throw std::out_of_range("insert pos out of range");
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::insert(const T& value, std::size_t pos) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::insert);
+    if (pos > size()) {
+        stats_.record_exception(Operation::insert);
+        throw std::out_of_range("insert pos out of range");
+    }
 
     if (pos == 0) this->push_front(value);
     else if (pos == size()) this->push_back(value);
     else {
-        Node* curr = sentinel_;
+        stats_.record_visits(Operation::insert, pos);
+        Link* curr = &head_;
         while (pos--) curr = curr->next;
 
-        Node* newNode = new Node(value, curr->next);
+        Node* newNode = createNode(value, curr->next);
         curr->next = newNode;
 
         size_++;
+        stats_.record_size(size_);
     }
 }
 
-template <typename T>
-T& SinglyLinkedList<T>::pop_front() {
-    if (empty()) throw std::out_of_range("pop_front on empty list");
+template <typename T, typename Stats>
+T SinglyLinkedList<T, Stats>::pop_front() {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::pop);
+    if (empty()) {
+        stats_.record_exception(Operation::pop);
+        throw std::out_of_range("pop_front on empty list");
+    }
 
-    Node* prevFront = sentinel_->next;
-    T* prevFrontValue = prevFront->value;
-    sentinel_->next = prevFront->next;
-    if (prevFront == tail_) tail_ = sentinel_;
-    delete prevFront;
+    Node* prevFront = head_.next;
+    T prevFrontValue = std::move(prevFront->value);
+    head_.next = prevFront->next;
+    if (prevFront == tail_) tail_ = &head_;
+    destroyNode(prevFront);
 
     size_--;
 
     return prevFrontValue;
 }
 
-template <typename T>
-T& SinglyLinkedList<T>::pop_back() {
-    if (empty()) throw std::out_of_range("pop_back on empty list");
+template <typename T, typename Stats>
+T SinglyLinkedList<T, Stats>::pop_back() {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::pop);
+    if (empty()) {
+        stats_.record_exception(Operation::pop);
+        throw std::out_of_range("pop_back on empty list");
+    }
 
-    Node* curr = sentinel_;
+    stats_.record_visits(Operation::pop, size_);
+    Link* curr = &head_;
     while (curr->next != tail_) curr = curr->next;
 
-    T* prevTailValue = tail_->value;
-    delete tail_;
+    Node* last = static_cast<Node*>(tail_);
+    T prevTailValue = std::move(last->value);
+    destroyNode(last);
     tail_ = curr;
     tail_->next = nullptr;
-    
+
     size_--;
 
     return prevTailValue;
 }
 
-template <typename T>
-T& SinglyLinkedList<T>::erase(std::size_t pos) {
-    if (pos > size()) throw std::out_of_range("erase pos out of range");
+template <typename T, typename Stats>
+T SinglyLinkedList<T, Stats>::erase(std::size_t pos) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::erase);
+    if (pos >= size()) {
+        stats_.record_exception(Operation::erase);
+        throw std::out_of_range("erase pos out of range");
+    }
 
     if (pos == 0) return this->pop_front();
     else if (pos == size()-1) return this->pop_back();
     else {
-        Node* curr = sentinel_;
+        stats_.record_visits(Operation::erase, pos + 1);
+        Link* curr = &head_;
         while (pos--) curr = curr->next;
 
         Node* nodeToDelete = curr->next;
-        T* deletedNodeValue = nodeToDelete->value;
+        T deletedNodeValue = std::move(nodeToDelete->value);
         curr->next = nodeToDelete->next;
-        delete nodeToDelete;
+        destroyNode(nodeToDelete);
 
         size_--;
 
@@ -217,25 +334,322 @@ T& SinglyLinkedList<T>::erase(std::size_t pos) {
     }
 }
 
-template <typename T>
-void SinglyLinkedList<T>::clear() {
-    while (size_ != 0) pop_front();
+template <typename T, typename Stats>
+template <class Pred>
+std::size_t SinglyLinkedList<T, Stats>::remove_if(Pred pred) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::erase);
+
+    // Removed nodes are chained through their own next pointers and only
+    // destroyed once the walk is over, so pred may still refer to them.
+    Node* removed = nullptr;
+    Node** removedTail = &removed;
+    std::size_t count = 0;
+
+    Link* prev = &head_;
+    try {
+        while (Node* curr = prev->next) {
+            if (pred(curr->value)) {
+                prev->next = curr->next;
+                *removedTail = curr;
+                removedTail = &curr->next;
+                count++;
+            } else {
+                prev = curr;
+            }
+        }
+    } catch (...) {
+        *removedTail = nullptr;
+        size_ -= count;
+        stats_.record_exception(Operation::erase);
+        destroyChain(removed);
+        throw;
+    }
+    *removedTail = nullptr;
+
+    stats_.record_visits(Operation::erase, size_);
+    tail_ = prev;
+    size_ -= count;
+    destroyChain(removed);
+
+    return count;
+}
+
+template <typename T, typename Stats>
+std::size_t SinglyLinkedList<T, Stats>::remove(const T& value) {
+    return remove_if([&value](const T& v) { return v == value; });
+}
+
+template <typename T, typename Stats>
+std::size_t SinglyLinkedList<T, Stats>::unique() {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::erase);
+    if (size_ < 2) return 0;
+
+    Node* removed = nullptr;
+    Node** removedTail = &removed;
+    std::size_t count = 0;
+
+    stats_.record_visits(Operation::erase, size_);
+    Node* prev = head_.next;
+    while (Node* curr = prev->next) {
+        if (curr->value == prev->value) {
+            prev->next = curr->next;
+            *removedTail = curr;
+            removedTail = &curr->next;
+            count++;
+        } else {
+            prev = curr;
+        }
+    }
+    *removedTail = nullptr;
+
+    tail_ = prev;
+    size_ -= count;
+    destroyChain(removed);
+
+    return count;
+}
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::iterator
+SinglyLinkedList<T, Stats>::erase_after(const_iterator pos) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::erase);
+    Link* prev = const_cast<Link*>(pos.current_);
+    if (!prev || !prev->next) {
+        stats_.record_exception(Operation::erase);
+        throw std::out_of_range("erase_after has no next element");
+    }
+
+    Node* nodeToDelete = prev->next;
+    prev->next = nodeToDelete->next;
+    if (nodeToDelete == tail_) tail_ = prev;
+    destroyNode(nodeToDelete);
+    size_--;
+
+    return iterator(prev->next);
+}
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::iterator
+SinglyLinkedList<T, Stats>::erase_after(const_iterator first, const_iterator last) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::erase);
+    Link* prev = const_cast<Link*>(first.current_);
+    Node* stop = static_cast<Node*>(const_cast<Link*>(last.current_));
+    if (!prev) {
+        stats_.record_exception(Operation::erase);
+        throw std::out_of_range("erase_after from end");
+    }
+    if (prev->next == stop) return iterator(stop);
+
+    Node* removed = prev->next;
+    Node* removedLast = removed;
+    std::size_t count = 1;
+    while (removedLast->next != stop) {
+        removedLast = removedLast->next;
+        count++;
+    }
+    stats_.record_visits(Operation::erase, count);
+
+    prev->next = stop;
+    removedLast->next = nullptr;
+    if (!stop) tail_ = prev;
+    size_ -= count;
+    destroyChain(removed);
+
+    return iterator(stop);
+}
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::iterator
+SinglyLinkedList<T, Stats>::erase(const_iterator first, const_iterator last) {
+    if (first == last) return iterator(const_cast<Link*>(last.current_));
+
+    std::size_t visited = 1;
+    Link* prev = &head_;
+    while (prev->next != first.current_) {
+        prev = prev->next;
+        visited++;
+    }
+    stats_.record_visits(Operation::erase, visited);
+
+    return erase_after(const_iterator(prev), last);
+}
+
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::clear() {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::clear);
+    Detached detached = detach();
+    if (!detached.head && !detached.block) return;
+
+    if (reclaimMode_ == ReclaimMode::immediate) {
+        freeNodes(detached, static_cast<std::size_t>(-1));
+        return;
+    }
+
+    Detached* handed = nullptr;
+    try {
+        handed = new Detached(detached);
+    } catch (...) {
+        freeNodes(detached, static_cast<std::size_t>(-1));
+        return;
+    }
+
+    if (reclaimMode_ == ReclaimMode::background) {
+        try {
+            NodeReclaimer::global().submit(handed, &reclaimStep);
+        } catch (...) {
+            reclaimStep(handed, static_cast<std::size_t>(-1));
+        }
+    } else {
+        if (pendingTail_) pendingTail_->next = handed;
+        else pending_ = handed;
+        pendingTail_ = handed;
+        pendingNodes_ += handed->count;
+    }
 }
 
 // ### Sort method and helpers ###
 
-template <typename T>
-void SinglyLinkedList<T>::sort() {
-    sentinel_ = sortList(sentinel_->next);
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::sort(SortStrategy strategy) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::sort);
+    blockOrdered_ = false;
+    segmentsStale_ = true;
 
-    Node* curr = sentinel_;
-    while (curr && curr->next) curr = curr->next;
-    tail_ = curr;
+    if (strategy == SortStrategy::automatic) {
+        if constexpr (RadixKey<T>) {
+            // Past a few digit passes, relinking the chain over and over
+            // costs more than sorting an array of node pointers once.
+            if (radixSort(std::identity{}, automaticRadixPasses)) {
+                compactIfFragmented();
+                return;
+            }
+        }
+        strategy = size_ >= pointerSortThreshold ? SortStrategy::pointer_array : SortStrategy::merge;
+    }
+
+    if (strategy == SortStrategy::radix) {
+        if constexpr (RadixKey<T>) {
+            radixSort(std::identity{});
+        } else {
+            stats_.record_exception(Operation::sort);
+            throw std::invalid_argument("radix sort needs an integral or floating-point element type");
+        }
+    } else if (strategy == SortStrategy::pointer_array) {
+        pointerSort();
+    } else {
+        head_.next = sortList(head_.next);
+
+        Link* curr = &head_;
+        while (curr->next) curr = curr->next;
+        tail_ = curr;
+    }
+
+    compactIfFragmented();
 }
 
-template <typename T>
-SinglyLinkedList<T>::Node*
-SinglyLinkedList<T>::sortList(Node* head) {
+template <typename T, typename Stats>
+template <class KeyFn>
+    requires RadixKey<std::decay_t<std::invoke_result_t<KeyFn&, const T&>>>
+void SinglyLinkedList<T, Stats>::sort(KeyFn key) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::sort);
+    blockOrdered_ = false;
+    segmentsStale_ = true;
+    radixSort(key);
+
+    compactIfFragmented();
+}
+
+template <typename T, typename Stats>
+template <class KeyFn>
+bool SinglyLinkedList<T, Stats>::radixSort(KeyFn key, std::size_t maxPasses) {
+    using Key = std::decay_t<std::invoke_result_t<KeyFn&, const T&>>;
+    using Bits = std::conditional_t<std::is_integral_v<Key>, std::make_unsigned<Key>,
+        std::conditional<sizeof(Key) == 4, std::uint32_t, std::uint64_t>>::type;
+    constexpr std::size_t radix = 256;
+
+    // Maps keys to unsigned integers with the same order
+    auto bitsOf = [&](const Node* node) -> Bits {
+        Key k = std::invoke(key, node->value);
+        if constexpr (std::is_floating_point_v<Key>) {
+            Bits bits = std::bit_cast<Bits>(k);
+            constexpr Bits sign = Bits(1) << (sizeof(Bits) * 8 - 1);
+            return (bits & sign) ? Bits(~bits) : Bits(bits | sign);
+        } else if constexpr (std::is_signed_v<Key>) {
+            return static_cast<Bits>(k) ^ (Bits(1) << (sizeof(Bits) * 8 - 1));
+        } else {
+            return k;
+        }
+    };
+
+    if (size_ < 2) return true;
+
+    // Digits on which every key agrees need no pass
+    Bits any = 0;
+    Bits all = static_cast<Bits>(~Bits(0));
+    for (Node* curr = head_.next; curr; curr = curr->next) {
+        Bits bits = bitsOf(curr);
+        any |= bits;
+        all &= bits;
+    }
+    Bits varying = any ^ all;
+
+    std::size_t passes = 0;
+    for (std::size_t shift = 0; shift < sizeof(Bits) * 8; shift += 8) {
+        if (((varying >> shift) & (radix - 1)) != 0) passes++;
+    }
+    if (passes > maxPasses) return false;
+
+    Node* head = head_.next;
+    Link* last = tail_;
+    Node* heads[radix];
+    Node* tails[radix];
+
+    for (std::size_t shift = 0; shift < sizeof(Bits) * 8; shift += 8) {
+        if (((varying >> shift) & (radix - 1)) == 0) continue;
+
+        std::fill(std::begin(heads), std::end(heads), nullptr);
+        for (Node* curr = head; curr; curr = curr->next) {
+            std::size_t digit = (bitsOf(curr) >> shift) & (radix - 1);
+            if (heads[digit]) tails[digit]->next = curr;
+            else heads[digit] = curr;
+            tails[digit] = curr;
+        }
+
+        head = nullptr;
+        last = nullptr;
+        for (std::size_t digit = 0; digit < radix; digit++) {
+            if (!heads[digit]) continue;
+            if (last) last->next = heads[digit];
+            else head = heads[digit];
+            last = tails[digit];
+        }
+        last->next = nullptr;
+    }
+
+    head_.next = head;
+    tail_ = last;
+    return true;
+}
+
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::pointerSort() {
+    if (size_ < 2) return;
+
+    std::vector<Node*> nodes;
+    nodes.reserve(size_);
+    for (Node* curr = head_.next; curr; curr = curr->next) nodes.push_back(curr);
+
+    std::sort(nodes.begin(), nodes.end(), [](const Node* a, const Node* b) { return a->value < b->value; });
+
+    head_.next = nodes.front();
+    for (std::size_t i = 0; i + 1 < nodes.size(); i++) nodes[i]->next = nodes[i+1];
+    nodes.back()->next = nullptr;
+    tail_ = nodes.back();
+}
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::Node*
+SinglyLinkedList<T, Stats>::sortList(Node* head) {
     if (!head || !head->next) return head;
 
     Node* middle = findMiddle(head);
@@ -248,14 +662,14 @@ SinglyLinkedList<T>::sortList(Node* head) {
     return merge(sortedLeftHead, sortedRightHead);
 }
 
-template <typename T>
-SinglyLinkedList<T>::Node*
-SinglyLinkedList<T>::merge(Node* head1, Node* head2) {
-    Node* dummy = new Node(T());
-    Node* curr = dummy;
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::Node*
+SinglyLinkedList<T, Stats>::merge(Node* head1, Node* head2) {
+    Link dummy;
+    Link* curr = &dummy;
 
     while (head1 && head2) {
-        if (head1->value <= head2->data) {
+        if (head1->value <= head2->value) {
             curr->next = head1;
             head1 = head1->next;
         } else {
@@ -269,15 +683,12 @@ SinglyLinkedList<T>::merge(Node* head1, Node* head2) {
     if (head1) curr->next = head1;
     else if (head2) curr->next = head2;
 
-    Node* sortedHead = dummy->next;
-    delete dummy;
-
-    return sortedHead;
+    return dummy.next;
 }
 
-template <typename T>
-SinglyLinkedList<T>::Node*
-SinglyLinkedList<T>::findMiddle(Node* head) {
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::Node*
+SinglyLinkedList<T, Stats>::findMiddle(Node* head) {
     if (!head) return nullptr;
 
     Node* slow = head;
@@ -290,3 +701,661 @@ SinglyLinkedList<T>::findMiddle(Node* head) {
 
     return slow;
 }
+
+// ### Set operations ###
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats> SinglyLinkedList<T, Stats>::set_union(const SinglyLinkedList& other, SetMode) const {
+    // Every element is copied, so there is nothing to skip
+    SinglyLinkedList result;
+    Node* a = head_.next;
+    Node* b = other.head_.next;
+
+    while (a && b) {
+        if (b->value < a->value) {
+            result.push_back(b->value);
+            b = b->next;
+        } else {
+            if (!(a->value < b->value)) b = b->next;
+            result.push_back(a->value);
+            a = a->next;
+        }
+    }
+    for (; a; a = a->next) result.push_back(a->value);
+    for (; b; b = b->next) result.push_back(b->value);
+
+    return result;
+}
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats> SinglyLinkedList<T, Stats>::set_intersection(const SinglyLinkedList& other, SetMode mode) const {
+    SinglyLinkedList result;
+    Link* a = &head_;
+    Link* b = &other.head_;
+
+    while (a->next && b->next) {
+        if (a->next->value < b->next->value) {
+            a = skipBefore(a, b->next->value, mode);
+        } else if (b->next->value < a->next->value) {
+            b = other.skipBefore(b, a->next->value, mode);
+        } else {
+            result.push_back(a->next->value);
+            a = a->next;
+            b = b->next;
+        }
+    }
+
+    return result;
+}
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats> SinglyLinkedList<T, Stats>::set_difference(const SinglyLinkedList& other, SetMode mode) const {
+    SinglyLinkedList result;
+    Node* a = head_.next;
+    Link* b = &other.head_;
+
+    while (a && b->next) {
+        if (a->value < b->next->value) {
+            result.push_back(a->value);
+            a = a->next;
+        } else if (b->next->value < a->value) {
+            b = other.skipBefore(b, a->value, mode);
+        } else {
+            a = a->next;
+            b = b->next;
+        }
+    }
+    for (; a; a = a->next) result.push_back(a->value);
+
+    return result;
+}
+
+template <typename T, typename Stats>
+bool SinglyLinkedList<T, Stats>::includes(const SinglyLinkedList& other, SetMode mode) const {
+    Link* a = &head_;
+    Node* b = other.head_.next;
+
+    while (b) {
+        a = skipBefore(a, b->value, mode);
+        if (!a->next || b->value < a->next->value) return false;
+        a = a->next;
+        b = b->next;
+    }
+
+    return true;
+}
+
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::set_union_in_place(SinglyLinkedList& other, SetMode mode) {
+    // Runs of *this are never touched, so with galloping a small other
+    // costs O(m log(n/m)) however long *this is.
+    Link* prev = &head_;
+    while (!other.empty()) {
+        const T& key = other.head_.next->value;
+        prev = skipBefore(prev, key, mode);
+        Node* next = prev->next;
+
+        if (next && !(key < next->value)) {
+            other.pop_front();
+            prev = next;
+            continue;
+        }
+
+        Node* node = takeFront(other);
+        node->next = next;
+        prev->next = node;
+        if (!next) tail_ = node;
+        size_++;
+        prev = node;
+    }
+
+    blockOrdered_ = false;
+    other.clear();
+    stats_.record_size(size_);
+}
+
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::set_intersection_in_place(SinglyLinkedList& other) {
+    Node* removed = nullptr;
+    Node** removedTail = &removed;
+    std::size_t count = 0;
+
+    Link* prev = &head_;
+    while (prev->next) {
+        Node* curr = prev->next;
+        while (!other.empty() && other.head_.next->value < curr->value) other.pop_front();
+        if (other.empty()) break;
+
+        if (curr->value < other.head_.next->value) {
+            prev->next = curr->next;
+            *removedTail = curr;
+            removedTail = &curr->next;
+            count++;
+        } else {
+            other.pop_front();
+            prev = curr;
+        }
+    }
+
+    // Whatever is left past the last match goes too
+    *removedTail = prev->next;
+    for (Node* curr = prev->next; curr; curr = curr->next) count++;
+    prev->next = nullptr;
+
+    tail_ = prev;
+    size_ -= count;
+    other.clear();
+    destroyChain(removed);
+}
+
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::set_difference_in_place(SinglyLinkedList& other, SetMode mode) {
+    Node* removed = nullptr;
+    Node** removedTail = &removed;
+    std::size_t count = 0;
+
+    Link* prev = &head_;
+    while (prev->next && !other.empty()) {
+        Node* curr = prev->next;
+        const T& key = other.head_.next->value;
+
+        if (curr->value < key) {
+            prev = skipBefore(prev, key, mode);
+        } else if (key < curr->value) {
+            other.pop_front();
+        } else {
+            prev->next = curr->next;
+            if (curr == tail_) tail_ = prev;
+            *removedTail = curr;
+            removedTail = &curr->next;
+            count++;
+            other.pop_front();
+        }
+    }
+    *removedTail = nullptr;
+
+    size_ -= count;
+    other.clear();
+    destroyChain(removed);
+}
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::Link*
+SinglyLinkedList<T, Stats>::skipBefore(Link* prev, const T& key, SetMode mode) const {
+    // Last node from prev on whose successor is missing or not less than key
+    Node* curr = prev->next;
+    if (!curr || !(curr->value < key)) return prev;
+
+    if (mode == SetMode::galloping && blockOrdered_ && inBlock(curr)) {
+        std::size_t lo = static_cast<std::size_t>(curr - block_);
+        std::size_t hi = lo + 1;
+        for (std::size_t step = 1; hi < blockCapacity_ && block_[hi].value < key; step *= 2) {
+            lo = hi;
+            hi = lo + step;
+        }
+        hi = std::min(hi, blockCapacity_);
+
+        while (hi - lo > 1) {
+            std::size_t mid = lo + (hi - lo) / 2;
+            if (block_[mid].value < key) lo = mid;
+            else hi = mid;
+        }
+        return block_ + lo;
+    }
+
+    while (curr->next && curr->next->value < key) curr = curr->next;
+    return curr;
+}
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::Node*
+SinglyLinkedList<T, Stats>::takeFront(SinglyLinkedList& other) {
+    Node* node = other.head_.next;
+
+    // Slots of other's block stay with other; their values are copied. The
+    // copy is spliced in like any relinked node, so *this stays searchable.
+    if (other.inBlock(node)) {
+        bool ordered = blockOrdered_;
+        Node* copy = createNode(node->value);
+        blockOrdered_ = ordered;
+        other.pop_front();
+        return copy;
+    }
+
+    other.head_.next = node->next;
+    if (node == other.tail_) other.tail_ = &other.head_;
+    other.size_--;
+    other.heapNodes_--;
+    other.segmentsStale_ = true;
+    heapNodes_++;
+    segmentsStale_ = true;
+    return node;
+}
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats> set_union(const SinglyLinkedList<T, Stats>& a, const SinglyLinkedList<T, Stats>& b, SetMode mode) {
+    return a.set_union(b, mode);
+}
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats> set_intersection(const SinglyLinkedList<T, Stats>& a, const SinglyLinkedList<T, Stats>& b, SetMode mode) {
+    return a.set_intersection(b, mode);
+}
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats> set_difference(const SinglyLinkedList<T, Stats>& a, const SinglyLinkedList<T, Stats>& b, SetMode mode) {
+    return a.set_difference(b, mode);
+}
+
+template <typename T, typename Stats>
+bool includes(const SinglyLinkedList<T, Stats>& a, const SinglyLinkedList<T, Stats>& b, SetMode mode) {
+    return a.includes(b, mode);
+}
+
+// ### Memory layout methods ###
+
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::compact() {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::compact);
+    if (empty()) {
+        releaseBlock();
+        return;
+    }
+
+    std::allocator<Node> alloc;
+    Node* block = alloc.allocate(size_);
+    stats_.record_allocation();
+    stats_.record_visits(Operation::compact, size_);
+
+    std::size_t built = 0;
+    try {
+        for (Node* curr = head_.next; curr; curr = curr->next, built++) {
+            std::construct_at(block + built, std::move_if_noexcept(curr->value));
+        }
+    } catch (...) {
+        std::destroy(block, block + built);
+        alloc.deallocate(block, size_);
+        throw;
+    }
+
+    for (std::size_t i = 0; i + 1 < size_; i++) block[i].next = &block[i+1];
+
+    Node* curr = head_.next;
+    while (curr) {
+        Node* next = curr->next;
+        if (inBlock(curr)) {
+            std::destroy_at(curr);
+        } else {
+            delete curr;
+            stats_.record_free();
+        }
+        curr = next;
+    }
+    if (block_) {
+        alloc.deallocate(block_, blockCapacity_);
+        stats_.record_free();
+    }
+
+    block_ = block;
+    blockCapacity_ = size_;
+    freeList_ = nullptr;
+    blockOrdered_ = true;
+    heapNodes_ = 0;
+    segmentsStale_ = true;
+
+    head_.next = block_;
+    tail_ = block_ + (size_-1);
+}
+
+template <typename T, typename Stats>
+double SinglyLinkedList<T, Stats>::fragmentation() const noexcept {
+    if (size_ < 2) return 0.0;
+
+    // A link is local when the next node sits a short stride ahead, close
+    // enough for the hardware prefetcher to follow a linear walk.
+    constexpr std::uintptr_t localWindow = 4 * 64;
+
+    std::size_t scattered = 0;
+    for (const Node* curr = head_.next; curr->next; curr = curr->next) {
+        auto from = reinterpret_cast<std::uintptr_t>(curr);
+        auto to = reinterpret_cast<std::uintptr_t>(curr->next);
+        if (to <= from || to - from > localWindow) scattered++;
+    }
+
+    return static_cast<double>(scattered) / static_cast<double>(size_-1);
+}
+
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::set_compact_threshold(double threshold) noexcept {
+    compactThreshold_ = threshold;
+}
+
+// fragmentation() never exceeds 1, so the default threshold skips its walk
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::compactIfFragmented() {
+    if (compactThreshold_ < 1.0 && fragmentation() > compactThreshold_) compact();
+}
+
+// ### Parallel algorithms ###
+
+template <typename T, typename Stats>
+template <class F>
+void SinglyLinkedList<T, Stats>::parallel_for_each(F f, std::size_t threads) {
+    forEachSegment(refreshSegments(), [&](std::size_t, Node* first, Node* last) {
+        for (Node* curr = first; curr != last; curr = curr->next) f(curr->value);
+    }, threads);
+}
+
+template <typename T, typename Stats>
+template <class F>
+void SinglyLinkedList<T, Stats>::parallel_transform(F f, std::size_t threads) {
+    forEachSegment(refreshSegments(), [&](std::size_t, Node* first, Node* last) {
+        for (Node* curr = first; curr != last; curr = curr->next) curr->value = f(std::as_const(curr->value));
+    }, threads);
+}
+
+template <typename T, typename Stats>
+template <class U, class Reduce, class Map>
+U SinglyLinkedList<T, Stats>::parallel_reduce(U init, Reduce reduce, Map map, std::size_t threads) const {
+    // Const callers may run concurrently, so a stale index is built locally
+    // instead of into the cache
+    std::vector<Node*> local;
+    if (segmentsStale_) buildSegments(local);
+    const std::vector<Node*>& segments = segmentsStale_ ? local : segments_;
+    std::vector<std::optional<U>> partials(segments.size());
+
+    forEachSegment(segments, [&](std::size_t segment, Node* first, Node* last) {
+        U partial = std::invoke(map, std::as_const(first->value));
+        for (Node* curr = first->next; curr != last; curr = curr->next) {
+            partial = std::invoke(reduce, std::move(partial), std::invoke(map, std::as_const(curr->value)));
+        }
+        partials[segment].emplace(std::move(partial));
+    }, threads);
+
+    for (auto& partial : partials) init = std::invoke(reduce, std::move(init), std::move(*partial));
+    return init;
+}
+
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::buildSegments(std::vector<Node*>& segments) const {
+    std::size_t length = std::max(minSegmentLength, (size_ + segmentTarget - 1) / segmentTarget);
+    segments.clear();
+    std::size_t i = 0;
+    for (Node* curr = head_.next; curr; curr = curr->next, i++) {
+        if (i % length == 0) segments.push_back(curr);
+    }
+}
+
+template <typename T, typename Stats>
+const std::vector<typename SinglyLinkedList<T, Stats>::Node*>& SinglyLinkedList<T, Stats>::refreshSegments() {
+    if (segmentsStale_) {
+        buildSegments(segments_);
+        segmentsStale_ = false;
+    }
+    return segments_;
+}
+
+template <typename T, typename Stats>
+template <class Fn>
+void SinglyLinkedList<T, Stats>::forEachSegment(const std::vector<Node*>& segments, Fn fn, std::size_t threads) const {
+    std::size_t count = segments.size();
+    if (count == 0) return;
+
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min(threads, count);
+
+    std::atomic<std::size_t> next = 0;
+    std::atomic<bool> failed = false;
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto work = [&] {
+        for (std::size_t i; !failed.load(std::memory_order_relaxed) && (i = next.fetch_add(1)) < count; ) {
+            try {
+                fn(i, segments[i], i + 1 < count ? segments[i+1] : nullptr);
+            } catch (...) {
+                std::lock_guard lock(errorMutex);
+                if (!error) error = std::current_exception();
+                failed = true;
+            }
+        }
+    };
+
+    {
+        // jthreads join on scope exit, including when a later spawn throws
+        std::vector<std::jthread> workers;
+        workers.reserve(threads - 1);
+        for (std::size_t t = 1; t < threads; t++) workers.emplace_back(work);
+        work();
+    }
+
+    if (error) std::rethrow_exception(error);
+}
+
+// ### Reclamation ###
+
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::set_reclaim_mode(ReclaimMode mode) noexcept {
+    reclaimMode_ = mode;
+}
+
+template <typename T, typename Stats>
+std::size_t SinglyLinkedList<T, Stats>::reclaim(std::size_t budget) {
+    while (pending_) {
+        std::size_t before = pending_->count;
+        bool done = freeNodes(*pending_, budget);
+        std::size_t freed = before - pending_->count;
+        pendingNodes_ -= freed;
+        budget -= std::min(freed, budget);
+        if (!done) break;
+
+        Detached* next = pending_->next;
+        delete pending_;
+        pending_ = next;
+        if (budget == 0) break;
+    }
+    if (!pending_) pendingTail_ = nullptr;
+
+    return pendingNodes_;
+}
+
+template <typename T, typename Stats>
+std::size_t SinglyLinkedList<T, Stats>::pending_reclaim() const noexcept {
+    return pendingNodes_;
+}
+
+template <typename T, typename Stats>
+typename SinglyLinkedList<T, Stats>::Detached SinglyLinkedList<T, Stats>::detach() noexcept {
+    Detached detached{head_.next, block_, blockCapacity_, heapNodes_, size_};
+    if constexpr (Stats::enabled) {
+        for (std::size_t i = 0; i < heapNodes_; i++) stats_.record_free();
+        if (block_) stats_.record_free();
+    }
+
+    head_.next = nullptr;
+    tail_ = &head_;
+    size_ = 0;
+    block_ = nullptr;
+    blockCapacity_ = 0;
+    freeList_ = nullptr;
+    blockOrdered_ = false;
+    heapNodes_ = 0;
+    segmentsStale_ = true;
+
+    return detached;
+}
+
+template <typename T, typename Stats>
+bool SinglyLinkedList<T, Stats>::freeNodes(Detached& detached, std::size_t budget) {
+    // Arena fast path: with every node in the block and nothing to destroy,
+    // the chain never has to be walked.
+    if (!std::is_trivially_destructible_v<T> || detached.heapNodes != 0) {
+        std::less<const Node*> before;
+        Node* block = detached.block;
+        Node* blockEnd = block + detached.blockCapacity;
+
+        for (; detached.head && budget > 0; budget--) {
+            Node* next = detached.head->next;
+            if (block && !before(detached.head, block) && before(detached.head, blockEnd)) {
+                std::destroy_at(detached.head);
+            } else {
+                delete detached.head;
+            }
+            detached.head = next;
+            detached.count--;
+        }
+        if (detached.head) return false;
+    }
+
+    if (detached.block) std::allocator<Node>().deallocate(detached.block, detached.blockCapacity);
+    detached.head = nullptr;
+    detached.block = nullptr;
+    detached.count = 0;
+    return true;
+}
+
+template <typename T, typename Stats>
+bool SinglyLinkedList<T, Stats>::reclaimStep(void* detached, std::size_t budget) {
+    auto* unit = static_cast<Detached*>(detached);
+    if (!freeNodes(*unit, budget)) return false;
+
+    delete unit;
+    return true;
+}
+
+// ### Statistics ###
+
+template <typename T, typename Stats>
+ContainerStats SinglyLinkedList<T, Stats>::stats() const noexcept {
+    return stats_.snapshot();
+}
+
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::reset_stats() noexcept {
+    stats_.reset();
+}
+
+// ### Snapshot methods ###
+
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::save(const std::string& path) const requires std::is_trivially_copyable_v<T> {
+    constexpr std::size_t chunk = std::max<std::size_t>(1, (1 << 16) / sizeof(T));
+
+    SnapshotWriter<T> writer(path, size_);
+    auto buffer = std::make_unique_for_overwrite<T[]>(chunk);
+
+    std::size_t filled = 0;
+    for (Node* curr = head_.next; curr; curr = curr->next) {
+        buffer[filled++] = curr->value;
+        if (filled == chunk) {
+            writer.write(buffer.get(), filled);
+            filled = 0;
+        }
+    }
+    writer.write(buffer.get(), filled);
+    writer.close();
+}
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats> SinglyLinkedList<T, Stats>::load(const std::string& path) requires std::is_trivially_copyable_v<T> {
+    constexpr std::size_t chunk = std::max<std::size_t>(1, (1 << 16) / sizeof(T));
+
+    SnapshotReader<T> reader(path);
+    SinglyLinkedList list;
+    std::size_t count = reader.count();
+    if (count == 0) return list;
+
+    std::allocator<Node> alloc;
+    Node* block = alloc.allocate(count);
+    list.stats_.record_allocation();
+    list.stats_.record_size(count);
+    auto buffer = std::make_unique_for_overwrite<T[]>(chunk);
+
+    try {
+        for (std::size_t done = 0; done < count; ) {
+            std::size_t n = std::min(chunk, count - done);
+            reader.read(buffer.get(), n);
+            for (std::size_t i = 0; i < n; i++, done++) {
+                std::construct_at(block + done, buffer[i], block + done + 1);
+            }
+        }
+    } catch (...) {
+        alloc.deallocate(block, count);
+        throw;
+    }
+    block[count-1].next = nullptr;
+
+    list.block_ = block;
+    list.blockCapacity_ = count;
+    list.head_.next = block;
+    list.tail_ = block + (count-1);
+    list.size_ = count;
+    list.blockOrdered_ = true;
+
+    return list;
+}
+
+// ### Node allocation helpers ###
+
+template <typename T, typename Stats>
+SinglyLinkedList<T, Stats>::Node*
+SinglyLinkedList<T, Stats>::createNode(const T& value, Node* next) {
+    blockOrdered_ = false;
+    segmentsStale_ = true;
+    if (!freeList_) {
+        stats_.record_allocation();
+        Node* node = new Node(value, next);
+        heapNodes_++;
+        return node;
+    }
+
+    FreeSlot* slot = freeList_;
+    freeList_ = slot->next;
+    try {
+        return ::new (static_cast<void*>(slot)) Node(value, next);
+    } catch (...) {
+        freeList_ = ::new (static_cast<void*>(slot)) FreeSlot{freeList_};
+        throw;
+    }
+}
+
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::destroyNode(Node* node) {
+    blockOrdered_ = false;
+    segmentsStale_ = true;
+    if (inBlock(node)) {
+        std::destroy_at(node);
+        freeList_ = ::new (static_cast<void*>(node)) FreeSlot{freeList_};
+    } else {
+        delete node;
+        heapNodes_--;
+        stats_.record_free();
+    }
+}
+
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::destroyChain(Node* head) {
+    while (head) {
+        Node* next = head->next;
+        destroyNode(head);
+        head = next;
+    }
+}
+
+template <typename T, typename Stats>
+bool SinglyLinkedList<T, Stats>::inBlock(const Node* node) const noexcept {
+    std::less<const Node*> before;
+    return block_ && !before(node, block_) && before(node, block_ + blockCapacity_);
+}
+
+template <typename T, typename Stats>
+void SinglyLinkedList<T, Stats>::releaseBlock() noexcept {
+    if (!block_ || size_ != 0) return;
+
+    std::allocator<Node>().deallocate(block_, blockCapacity_);
+    stats_.record_free();
+    block_ = nullptr;
+    blockCapacity_ = 0;
+    freeList_ = nullptr;
+    blockOrdered_ = false;
+}
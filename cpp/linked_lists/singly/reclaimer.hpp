@@ -0,0 +1,50 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// Process-wide background thread that frees detached node chains, so the
+// thread that drops a large container does not pay for it. Jobs are opaque:
+// step(job, budget) frees up to `budget` nodes and returns true once the
+// job is finished and has released itself.
+class NodeReclaimer {
+public:
+    using Step = bool (*)(void* job, std::size_t budget);
+private:
+    struct Job {
+        void* job;
+        Step step;
+    };
+
+    static constexpr std::size_t batch = 4096;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable idle_;
+    std::deque<Job> queue_;
+    bool busy_ = false;
+    bool stopping_ = false;
+    std::thread worker_;
+
+    NodeReclaimer() = default;
+
+    void run();
+public:
+    NodeReclaimer(const NodeReclaimer&) = delete;
+    NodeReclaimer& operator=(const NodeReclaimer&) = delete;
+
+    // Finishes every queued job before returning
+    ~NodeReclaimer();
+
+    static NodeReclaimer& global();
+
+    void submit(void* job, Step step);
+
+    // Blocks until everything submitted so far has been freed
+    void drain();
+};
+
+#include "reclaimer.inl"
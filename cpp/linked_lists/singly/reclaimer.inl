@@ -0,0 +1,56 @@
+#include "reclaimer.hpp"
+
+inline NodeReclaimer::~NodeReclaimer() {
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_one();
+    if (worker_.joinable()) worker_.join();
+}
+
+inline NodeReclaimer& NodeReclaimer::global() {
+    static NodeReclaimer reclaimer;
+    return reclaimer;
+}
+
+inline void NodeReclaimer::submit(void* job, Step step) {
+    {
+        std::lock_guard lock(mutex_);
+        queue_.push_back({job, step});
+        // A job is either queued with a worker to run it or handed back
+        if (!worker_.joinable()) {
+            try {
+                worker_ = std::thread([this] { run(); });
+            } catch (...) {
+                queue_.pop_back();
+                throw;
+            }
+        }
+    }
+    wake_.notify_one();
+}
+
+inline void NodeReclaimer::drain() {
+    std::unique_lock lock(mutex_);
+    idle_.wait(lock, [this] { return queue_.empty() && !busy_; });
+}
+
+inline void NodeReclaimer::run() {
+    std::unique_lock lock(mutex_);
+    while (true) {
+        wake_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+        if (queue_.empty()) return;
+
+        Job job = queue_.front();
+        queue_.pop_front();
+        busy_ = true;
+
+        lock.unlock();
+        while (!job.step(job.job, batch)) {}
+        lock.lock();
+
+        busy_ = false;
+        if (queue_.empty()) idle_.notify_all();
+    }
+}
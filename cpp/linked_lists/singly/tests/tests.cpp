@@ -1,7 +1,20 @@
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <ranges>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
+#include "../find_many.hpp"
 #include "../list.hpp"
 
 TEST_CASE("Default construction", "[constructor]") {
@@ -12,6 +25,35 @@ TEST_CASE("Default construction", "[constructor]") {
     REQUIRE(list.begin() == list.end());
 }
 
+struct NoDefault {
+    int value;
+
+    explicit NoDefault(int v) : value(v) {}
+    auto operator<=>(const NoDefault&) const = default;
+};
+
+static_assert(std::is_nothrow_move_constructible_v<SinglyLinkedList<NoDefault>>);
+
+TEST_CASE("Elements need no default constructor", "[constructor]") {
+    SinglyLinkedList<NoDefault> list;
+    list.push_back(NoDefault(3));
+    list.push_front(NoDefault(1));
+    list.push_back(NoDefault(2));
+
+    list.sort(SortStrategy::merge);
+    REQUIRE(list.front().value == 1);
+    REQUIRE(list.back().value == 3);
+
+    SinglyLinkedList<NoDefault> moved(std::move(list));
+    REQUIRE(list.empty());
+    REQUIRE(moved.size() == 3);
+
+    list.push_back(NoDefault(4));
+    REQUIRE(list.pop_back().value == 4);
+    REQUIRE(moved.pop_back().value == 3);
+    REQUIRE(moved.back().value == 2);
+}
+
 TEST_CASE("push_front", "[modifiers]") {
     SinglyLinkedList<int> list;
 
@@ -220,3 +262,647 @@ TEST_CASE("works with non-trivial types", "[templates]") {
     REQUIRE(list.back() == "world");
 }
 
+
+TEST_CASE("compact keeps order and relinearizes nodes", "[memory]") {
+    SinglyLinkedList<int> list;
+    for (int i = 0; i < 100; ++i) list.push_front(i);
+
+    list.sort();
+    list.compact();
+
+    REQUIRE(list.size() == 100);
+    REQUIRE(list.fragmentation() == 0.0);
+    REQUIRE(list.front() == 0);
+    REQUIRE(list.back() == 99);
+
+    int expected = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) {
+        REQUIRE(*it == expected++);
+    }
+}
+
+TEST_CASE("compacted list reuses released slots", "[memory]") {
+    SinglyLinkedList<std::string> list;
+    for (int i = 0; i < 10; ++i) list.push_back(std::to_string(i));
+    list.compact();
+
+    list.erase(4);
+    list.pop_front();
+    list.push_back("10");
+    list.insert("11", 2);
+
+    REQUIRE(list.size() == 10);
+    REQUIRE(list.front() == "1");
+    REQUIRE(list[2] == "11");
+    REQUIRE(list.back() == "10");
+
+    list.clear();
+    REQUIRE(list.empty());
+    list.push_back("again");
+    REQUIRE(list.front() == "again");
+}
+
+TEST_CASE("sort compacts past the fragmentation threshold", "[memory]") {
+    SinglyLinkedList<int> list;
+    for (int i = 0; i < 64; ++i) list.push_back((i * 37) % 64);
+
+    list.set_compact_threshold(0.5);
+    list.sort();
+
+    REQUIRE(list.fragmentation() == 0.0);
+    REQUIRE(list.front() == 0);
+    REQUIRE(list.back() == 63);
+}
+
+TEMPLATE_TEST_CASE("every sort strategy orders random keys", "[sort]", std::uint8_t, std::int32_t, std::uint64_t, std::int64_t, float, double) {
+    std::mt19937_64 rng(7);
+    for (std::size_t n : {0, 1, 2, 63, 64, 500}) {
+        std::vector<TestType> values(n);
+        for (auto& v : values) {
+            if constexpr (std::is_floating_point_v<TestType>) {
+                v = static_cast<TestType>(std::uniform_real_distribution<double>(-1e6, 1e6)(rng));
+            } else {
+                v = static_cast<TestType>(rng());
+            }
+        }
+        if (n > 3) values[1] = values[3];
+        std::vector<TestType> expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        for (auto strategy : {SortStrategy::automatic, SortStrategy::merge, SortStrategy::pointer_array, SortStrategy::radix}) {
+            SinglyLinkedList<TestType> list;
+            for (auto v : values) list.push_back(v);
+            list.sort(strategy);
+
+            std::vector<TestType> sorted;
+            for (auto it = list.cbegin(); it != list.cend(); ++it) sorted.push_back(*it);
+            REQUIRE(sorted == expected);
+            if (n > 0) REQUIRE(list.back() == expected.back());
+
+            list.push_back(TestType(1));
+            REQUIRE(list.back() == TestType(1));
+            REQUIRE(list.size() == n + 1);
+        }
+    }
+}
+
+TEST_CASE("radix sort orders negative and signed-zero floats", "[sort]") {
+    SinglyLinkedList<double> list;
+    for (double v : {3.5, -0.0, -2.25, 1e300, -1e300, 0.0, -7.0}) list.push_back(v);
+
+    list.sort(SortStrategy::radix);
+
+    std::vector<double> sorted;
+    for (auto it = list.cbegin(); it != list.cend(); ++it) sorted.push_back(*it);
+    REQUIRE(sorted == std::vector<double>{-1e300, -7.0, -2.25, -0.0, 0.0, 3.5, 1e300});
+    REQUIRE(std::signbit(sorted[3]));
+}
+
+TEST_CASE("key extractor sort is stable", "[sort]") {
+    struct Record {
+        std::int32_t key;
+        int order;
+    };
+
+    std::mt19937 rng(3);
+    SinglyLinkedList<Record> list;
+    for (int i = 0; i < 1000; ++i) list.push_back({static_cast<std::int32_t>(rng() % 50) - 25, i});
+
+    list.sort([](const Record& r) { return r.key; });
+
+    REQUIRE(list.size() == 1000);
+    const Record* prev = nullptr;
+    for (auto it = list.cbegin(); it != list.cend(); ++it) {
+        if (prev) {
+            REQUIRE(prev->key <= it->key);
+            if (prev->key == it->key) REQUIRE(prev->order < it->order);
+        }
+        prev = &*it;
+    }
+    REQUIRE(&list.back() == prev);
+}
+
+TEST_CASE("radix sort is rejected for non-numeric elements", "[sort]") {
+    SinglyLinkedList<std::string> list;
+    list.push_back("b");
+    list.push_back("a");
+
+    REQUIRE_THROWS_AS(list.sort(SortStrategy::radix), std::invalid_argument);
+    list.sort(SortStrategy::pointer_array);
+    REQUIRE(list.front() == "a");
+    REQUIRE(list.back() == "b");
+}
+
+TEST_CASE("find_many matches find for every group size", "[find_many]") {
+    std::vector<SinglyLinkedList<int>> lists(5);
+    for (int l = 0; l < 5; ++l) {
+        for (int i = 0; i < l * 7; ++i) lists[l].push_back(i * 3 + l);
+    }
+
+    std::vector<const SinglyLinkedList<int>*> targets;
+    std::vector<int> keys;
+    for (int k = 0; k < 60; ++k) {
+        targets.push_back(&lists[k % 5]);
+        keys.push_back(k);
+    }
+
+    for (std::size_t group : {1, 2, 3, 8, 32, 100}) {
+        std::vector<const int*> out(keys.size(), &keys[0]);
+        find_many(targets, keys, out, group);
+
+        for (std::size_t k = 0; k < keys.size(); ++k) {
+            auto node = targets[k]->find(keys[k]);
+            if (node == nullptr) {
+                REQUIRE(out[k] == nullptr);
+            } else {
+                REQUIRE(out[k] == &node->value);
+            }
+        }
+    }
+}
+
+TEST_CASE("find_many returns the first match", "[find_many]") {
+    SinglyLinkedList<std::string> list;
+    list.push_back("a");
+    list.push_back("b");
+    list.push_back("b");
+
+    std::vector<const SinglyLinkedList<std::string>*> targets{&list, &list, &list};
+    std::vector<std::string> keys{"b", "a", "z"};
+    std::vector<const std::string*> out(3);
+    find_many(targets, keys, out);
+
+    REQUIRE(out[0] == &list[1]);
+    REQUIRE(out[1] == &list.front());
+    REQUIRE(out[2] == nullptr);
+}
+
+TEST_CASE("find_many handles empty and mismatched batches", "[find_many]") {
+    std::vector<const SinglyLinkedList<int>*> targets;
+    std::vector<int> keys;
+    std::vector<const int*> out;
+    find_many(targets, keys, out);
+
+    keys.push_back(1);
+    REQUIRE_THROWS_AS(find_many(targets, keys, out), std::invalid_argument);
+}
+
+TEST_CASE("remove_if removes matches in one pass", "[removal]") {
+    SinglyLinkedList<int> list;
+    for (int i = 0; i < 10; ++i) list.push_back(i);
+
+    REQUIRE(list.remove_if([](int v) { return v % 3 == 0; }) == 4);
+    REQUIRE(list.size() == 6);
+    REQUIRE(list.front() == 1);
+    REQUIRE(list.back() == 8);
+
+    list.push_back(100);
+    REQUIRE(list.back() == 100);
+    REQUIRE(list[5] == 8);
+
+    REQUIRE(list.remove_if([](int) { return true; }) == 7);
+    REQUIRE(list.empty());
+    list.push_back(1);
+    REQUIRE(list.front() == 1);
+    REQUIRE(list.back() == 1);
+}
+
+TEST_CASE("remove accepts a reference into the list", "[removal]") {
+    SinglyLinkedList<std::string> list;
+    for (const char* s : {"a", "b", "a", "c", "a"}) list.push_back(s);
+
+    REQUIRE(list.remove(list.front()) == 3);
+    REQUIRE(list.size() == 2);
+    REQUIRE(list.front() == "b");
+    REQUIRE(list.back() == "c");
+}
+
+TEST_CASE("remove_if keeps the list consistent when pred throws", "[removal]") {
+    SinglyLinkedList<int> list;
+    for (int i = 0; i < 6; ++i) list.push_back(i);
+
+    REQUIRE_THROWS_AS(list.remove_if([](int v) {
+        if (v == 4) throw std::runtime_error("stop");
+        return v % 2 == 0;
+    }), std::runtime_error);
+
+    REQUIRE(list.size() == 4);
+    REQUIRE(list[0] == 1);
+    REQUIRE(list[1] == 3);
+    REQUIRE(list[2] == 4);
+    REQUIRE(list.back() == 5);
+}
+
+TEST_CASE("unique collapses consecutive duplicates", "[removal]") {
+    SinglyLinkedList<int> list;
+    for (int v : {1, 1, 2, 3, 3, 3, 1, 4, 4}) list.push_back(v);
+
+    REQUIRE(list.unique() == 4);
+    REQUIRE(list.size() == 5);
+    int expected[] = {1, 2, 3, 1, 4};
+    for (int i = 0; i < 5; ++i) REQUIRE(list[i] == expected[i]);
+    REQUIRE(list.back() == 4);
+}
+
+TEST_CASE("erase_after unlinks the following element", "[removal]") {
+    SinglyLinkedList<int> list;
+    for (int i = 0; i < 4; ++i) list.push_back(i);
+
+    auto it = list.erase_after(list.cbefore_begin());
+    REQUIRE(*it == 1);
+    REQUIRE(list.front() == 1);
+
+    it = list.erase_after(list.begin());
+    REQUIRE(*it == 3);
+
+    it = list.erase_after(list.begin());
+    REQUIRE(it == list.end());
+    REQUIRE(list.size() == 1);
+    REQUIRE(list.back() == 1);
+
+    REQUIRE_THROWS_AS(list.erase_after(list.begin()), std::out_of_range);
+}
+
+TEST_CASE("range erase removes [first, last)", "[removal]") {
+    SinglyLinkedList<int> list;
+    for (int i = 0; i < 8; ++i) list.push_back(i);
+
+    auto first = list.begin();
+    ++first;
+    ++first;
+    auto last = first;
+    ++last;
+    ++last;
+    ++last;
+
+    auto it = list.erase(first, last);
+    REQUIRE(*it == 5);
+    REQUIRE(list.size() == 5);
+    REQUIRE(list[2] == 5);
+
+    it = list.erase(list.begin(), list.begin());
+    REQUIRE(it == list.begin());
+    REQUIRE(list.size() == 5);
+
+    auto tailStart = list.begin();
+    ++tailStart;
+    ++tailStart;
+    REQUIRE(list.erase(tailStart, list.end()) == list.end());
+    REQUIRE(list.size() == 2);
+    REQUIRE(list.back() == 1);
+
+    list.erase(list.begin(), list.end());
+    REQUIRE(list.empty());
+    list.push_back(9);
+    REQUIRE(list.front() == 9);
+}
+
+TEST_CASE("batched removal returns compacted slots to the free list", "[removal][memory]") {
+    SinglyLinkedList<int, CountingStats> list;
+    for (int i = 0; i < 100; ++i) list.push_back(i);
+    list.compact();
+    list.reset_stats();
+
+    REQUIRE(list.remove_if([](int v) { return v % 2 == 1; }) == 50);
+    for (int i = 0; i < 50; ++i) list.push_back(i);
+
+    auto stats = list.stats();
+    REQUIRE(stats.allocations == 0);
+    REQUIRE(stats.frees == 0);
+    REQUIRE(list.size() == 100);
+}
+
+namespace {
+
+std::vector<int> sortedValues(std::mt19937& rng, std::size_t n, int range) {
+    std::vector<int> values(n);
+    for (auto& v : values) v = static_cast<int>(rng() % range);
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+SinglyLinkedList<int> listOf(const std::vector<int>& values, bool compacted) {
+    SinglyLinkedList<int> list;
+    for (int v : values) list.push_back(v);
+    if (compacted) list.compact();
+    return list;
+}
+
+std::vector<int> valuesOf(const SinglyLinkedList<int>& list) {
+    std::vector<int> values;
+    for (auto it = list.cbegin(); it != list.cend(); ++it) values.push_back(*it);
+    return values;
+}
+
+}
+
+TEST_CASE("set operations match the std algorithms", "[set]") {
+    std::mt19937 rng(7);
+
+    for (int round = 0; round < 40; ++round) {
+        auto a = sortedValues(rng, rng() % 60, 40);
+        auto b = sortedValues(rng, rng() % 60, 40);
+
+        std::vector<int> unionExpected, intersectionExpected, differenceExpected;
+        std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(unionExpected));
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(intersectionExpected));
+        std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(differenceExpected));
+        bool includesExpected = std::includes(a.begin(), a.end(), b.begin(), b.end());
+        bool includesIntersection = std::includes(a.begin(), a.end(), intersectionExpected.begin(), intersectionExpected.end());
+
+        for (SetMode mode : {SetMode::linear, SetMode::galloping}) {
+            for (bool compacted : {false, true}) {
+                auto listA = listOf(a, compacted);
+                auto listB = listOf(b, compacted);
+
+                REQUIRE(valuesOf(set_union(listA, listB, mode)) == unionExpected);
+                REQUIRE(valuesOf(set_intersection(listA, listB, mode)) == intersectionExpected);
+                REQUIRE(valuesOf(set_difference(listA, listB, mode)) == differenceExpected);
+                REQUIRE(includes(listA, listB, mode) == includesExpected);
+                REQUIRE(listA.includes(listOf(intersectionExpected, false), mode) == includesIntersection);
+            }
+        }
+    }
+}
+
+TEST_CASE("in-place set operations relink both inputs", "[set]") {
+    std::mt19937 rng(11);
+
+    for (int round = 0; round < 40; ++round) {
+        auto a = sortedValues(rng, rng() % 60, 40);
+        auto b = sortedValues(rng, rng() % 60, 40);
+
+        std::vector<int> unionExpected, intersectionExpected, differenceExpected;
+        std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(unionExpected));
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(intersectionExpected));
+        std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(differenceExpected));
+
+        for (SetMode mode : {SetMode::linear, SetMode::galloping}) {
+            for (bool compactA : {false, true}) {
+                for (bool compactB : {false, true}) {
+                    auto listA = listOf(a, compactA);
+                    auto listB = listOf(b, compactB);
+                    listA.set_union_in_place(listB, mode);
+                    REQUIRE(valuesOf(listA) == unionExpected);
+                    REQUIRE(listA.size() == unionExpected.size());
+                    REQUIRE(listB.empty());
+                    if (!listA.empty()) REQUIRE(listA.back() == unionExpected.back());
+                    listA.push_back(1000);
+                    REQUIRE(listA.back() == 1000);
+
+                    listA = listOf(a, compactA);
+                    listB = listOf(b, compactB);
+                    listA.set_intersection_in_place(listB);
+                    REQUIRE(valuesOf(listA) == intersectionExpected);
+                    REQUIRE(listA.size() == intersectionExpected.size());
+                    REQUIRE(listB.empty());
+                    listA.push_back(1000);
+                    REQUIRE(listA.back() == 1000);
+
+                    listA = listOf(a, compactA);
+                    listB = listOf(b, compactB);
+                    listA.set_difference_in_place(listB, mode);
+                    REQUIRE(valuesOf(listA) == differenceExpected);
+                    REQUIRE(listA.size() == differenceExpected.size());
+                    REQUIRE(listB.empty());
+                    listA.push_back(1000);
+                    REQUIRE(listA.back() == 1000);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("galloping falls back to a walk once the block is relinked", "[set]") {
+    auto list = listOf({1, 3, 5, 7, 9}, true);
+    list.erase(1);
+    list.insert(4, 1);
+
+    auto other = listOf({4, 9}, false);
+    REQUIRE(valuesOf(list.set_intersection(other, SetMode::galloping)) == std::vector<int>{4, 9});
+    REQUIRE(list.includes(other, SetMode::galloping));
+}
+
+namespace {
+
+struct Tracked {
+    static inline std::atomic<int> live = 0;
+    int value;
+
+    Tracked(int v = 0) : value(v) { live++; }
+    Tracked(const Tracked& other) : value(other.value) { live++; }
+    ~Tracked() { live--; }
+
+    bool operator<(const Tracked& other) const { return value < other.value; }
+};
+
+}
+
+TEST_CASE("deferred clear frees nodes only when reclaimed", "[reclaim]") {
+    SinglyLinkedList<Tracked> list;
+    int baseline = Tracked::live;
+    list.set_reclaim_mode(ReclaimMode::deferred);
+    for (int i = 0; i < 100; ++i) list.push_back(i);
+
+    list.clear();
+    REQUIRE(list.empty());
+    REQUIRE(list.pending_reclaim() == 100);
+    REQUIRE(Tracked::live == baseline + 100);
+
+    list.push_back(1);
+    REQUIRE(list.front().value == 1);
+    list.clear();
+    REQUIRE(list.pending_reclaim() == 101);
+
+    REQUIRE(list.reclaim(30) == 71);
+    REQUIRE(Tracked::live == baseline + 71);
+    REQUIRE(list.reclaim(70) == 1);
+    REQUIRE(list.reclaim() == 0);
+    REQUIRE(Tracked::live == baseline);
+}
+
+TEST_CASE("deferred reclamation covers compacted blocks", "[reclaim][memory]") {
+    SinglyLinkedList<std::string, CountingStats> list;
+    list.set_reclaim_mode(ReclaimMode::deferred);
+    for (int i = 0; i < 50; ++i) list.push_back(std::string(32, 'a' + i % 26));
+    list.compact();
+    list.push_back("heap");
+    list.reset_stats();
+
+    list.clear();
+    REQUIRE(list.stats().frees == 2);
+    REQUIRE(list.pending_reclaim() == 51);
+    REQUIRE(list.reclaim(10) == 41);
+    REQUIRE(list.reclaim() == 0);
+}
+
+TEST_CASE("a destroyed list hands deferred nodes to the background reclaimer", "[reclaim]") {
+    NodeReclaimer::global().drain();
+    int baseline = Tracked::live;
+    {
+        SinglyLinkedList<Tracked> list;
+        list.set_reclaim_mode(ReclaimMode::deferred);
+        for (int i = 0; i < 1000; ++i) list.push_back(i);
+        list.clear();
+        for (int i = 0; i < 1000; ++i) list.push_back(i);
+    }
+    NodeReclaimer::global().drain();
+    REQUIRE(Tracked::live == baseline);
+}
+
+TEST_CASE("background clear frees nodes off the calling thread", "[reclaim]") {
+    SinglyLinkedList<Tracked> list;
+    int baseline = Tracked::live;
+    list.set_reclaim_mode(ReclaimMode::background);
+    for (int i = 0; i < 10000; ++i) list.push_back(i);
+    list.compact();
+    for (int i = 0; i < 10; ++i) list.push_front(i);
+
+    list.clear();
+    REQUIRE(list.empty());
+    REQUIRE(list.pending_reclaim() == 0);
+    list.push_back(7);
+    REQUIRE(list.back().value == 7);
+
+    NodeReclaimer::global().drain();
+    REQUIRE(Tracked::live == baseline + 1);
+}
+
+TEST_CASE("arena lists release their block without a walk", "[reclaim][memory]") {
+    SinglyLinkedList<int, CountingStats> list;
+    list.set_reclaim_mode(ReclaimMode::deferred);
+    for (int i = 0; i < 1000; ++i) list.push_back(i);
+    list.compact();
+    list.reset_stats();
+
+    list.clear();
+    REQUIRE(list.stats().frees == 1);
+    REQUIRE(list.reclaim(1) == 0);
+}
+
+TEST_CASE("parallel algorithms match a sequential walk", "[parallel]") {
+    for (std::size_t n : {0, 1, 1000, 1025, 100000}) {
+        SinglyLinkedList<std::uint64_t> list;
+        for (std::size_t i = 0; i < n; ++i) list.push_back(i);
+
+        for (std::size_t threads : {0, 1, 3, 8}) {
+            std::uint64_t sum = list.parallel_reduce(std::uint64_t(0), std::plus<>{}, std::identity{}, threads);
+            REQUIRE(sum == (n == 0 ? 0 : n * (n - 1) / 2));
+
+            std::atomic<std::size_t> visited = 0;
+            list.parallel_for_each([&](std::uint64_t&) { visited++; }, threads);
+            REQUIRE(visited == n);
+        }
+
+        list.parallel_transform([](std::uint64_t v) { return v * 2; }, 4);
+        std::uint64_t expected = 0;
+        bool ordered = true;
+        for (auto it = list.cbegin(); it != list.cend(); ++it, expected += 2) ordered &= *it == expected;
+        REQUIRE(ordered);
+    }
+}
+
+TEST_CASE("parallel_reduce combines partial results in list order", "[parallel]") {
+    SinglyLinkedList<int> list;
+    for (int i = 0; i < 5000; ++i) list.push_back(i % 10);
+
+    auto digits = list.parallel_reduce(std::string(">"), std::plus<>{}, [](int v) { return std::to_string(v); }, 4);
+
+    std::string expected = ">";
+    for (int i = 0; i < 5000; ++i) expected += std::to_string(i % 10);
+    REQUIRE(digits == expected);
+}
+
+TEST_CASE("the segment index is rebuilt after mutations", "[parallel]") {
+    SinglyLinkedList<int> list;
+    for (int i = 0; i < 10000; ++i) list.push_back(1);
+    REQUIRE(list.parallel_reduce(0, std::plus<>{}, std::identity{}, 4) == 10000);
+
+    list.push_front(5);
+    list.erase(list.size() / 2);
+    REQUIRE(list.parallel_reduce(0, std::plus<>{}, std::identity{}, 4) == 10004);
+
+    list.remove_if([](int v) { return v == 5; });
+    list.sort();
+    REQUIRE(list.parallel_reduce(0, std::plus<>{}, std::identity{}, 4) == 9999);
+
+    list.compact();
+    list.clear();
+    REQUIRE(list.parallel_reduce(7, std::plus<>{}, std::identity{}, 4) == 7);
+}
+
+TEST_CASE("concurrent parallel_reduce calls on a const list", "[parallel][const]") {
+    SinglyLinkedList<int> list;
+    for (int i = 0; i < 10000; ++i) list.push_back(1);
+    const SinglyLinkedList<int>& view = list;
+
+    int sums[2] = {};
+    {
+        std::vector<std::jthread> readers;
+        for (int& sum : sums) {
+            readers.emplace_back([&view, &sum] { sum = view.parallel_reduce(0, std::plus<>{}, std::identity{}, 2); });
+        }
+    }
+    REQUIRE(sums[0] == 10000);
+    REQUIRE(sums[1] == 10000);
+}
+
+TEST_CASE("parallel_for_each rethrows a worker exception", "[parallel]") {
+    SinglyLinkedList<int> list;
+    for (int i = 0; i < 20000; ++i) list.push_back(i);
+
+    REQUIRE_THROWS_AS(list.parallel_for_each([](int& v) {
+        if (v == 12345) throw std::runtime_error("bad element");
+    }, 4), std::runtime_error);
+}
+
+static_assert(std::forward_iterator<SinglyLinkedList<int>::iterator>);
+static_assert(std::forward_iterator<SinglyLinkedList<int>::const_iterator>);
+static_assert(std::sentinel_for<SinglyLinkedList<int>::const_iterator, SinglyLinkedList<int>::const_iterator>);
+static_assert(std::ranges::forward_range<SinglyLinkedList<int>>);
+static_assert(std::ranges::forward_range<const SinglyLinkedList<int>>);
+static_assert(std::ranges::sized_range<SinglyLinkedList<int>>);
+static_assert(std::ranges::common_range<SinglyLinkedList<int>>);
+static_assert(std::is_same_v<std::ranges::range_reference_t<const SinglyLinkedList<int>>, const int&>);
+
+TEST_CASE("iterators work with std algorithms", "[iterators]") {
+    SinglyLinkedList<std::string> list;
+    for (const char* word : {"delta", "alpha", "charlie", "bravo"}) list.push_back(word);
+
+    std::vector<std::string> copy(list.begin(), list.end());
+    REQUIRE(copy == std::vector<std::string>{"delta", "alpha", "charlie", "bravo"});
+
+    auto it = list.begin();
+    auto before = it++;
+    REQUIRE(*before == "delta");
+    REQUIRE(it->size() == 5);
+    REQUIRE(std::distance(list.cbegin(), list.cend()) == 4);
+
+    auto found = std::find(list.begin(), list.end(), "charlie");
+    REQUIRE(found != list.end());
+    *found = "echo";
+    REQUIRE(list[2] == "echo");
+
+    const auto& view = list;
+    REQUIRE(*std::max_element(view.begin(), view.end()) == "echo");
+    REQUIRE(std::ranges::size(view) == 4);
+}
+
+TEST_CASE("lazy range pipelines run over the list", "[iterators]") {
+    SinglyLinkedList<int> list;
+    for (int i = 1; i <= 10; ++i) list.push_back(i);
+
+    auto squaresOfEvens = list
+        | std::views::filter([](int v) { return v % 2 == 0; })
+        | std::views::transform([](int v) { return v * v; });
+
+    std::vector<int> result;
+    std::ranges::copy(squaresOfEvens, std::back_inserter(result));
+    REQUIRE(result == std::vector<int>{4, 16, 36, 64, 100});
+
+    REQUIRE(std::ranges::count_if(list, [](int v) { return v > 7; }) == 3);
+    REQUIRE(*std::ranges::find(list, 6) == 6);
+
+    for (int& v : list | std::views::take(3)) v = 0;
+    REQUIRE(std::ranges::equal(list | std::views::take(4), std::vector<int>{0, 0, 0, 4}));
+}
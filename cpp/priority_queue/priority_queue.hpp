@@ -0,0 +1,123 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <vector>
+
+// Heap with D children per node, stored in one vector like Stack. With
+// Compare = std::less the largest element is on top, as in
+// std::priority_queue. A wider node makes the heap shallower and puts the
+// children compared in one sift-down step next to each other in memory.
+//
+// Elements pushed with push_handle() can later be moved towards the top
+// with decrease_key(). Handles cost nothing until the first one is taken;
+// from then on every element carries an id.
+template <typename T, typename Compare = std::less<T>, std::size_t D = 4>
+class PriorityQueue {
+    static_assert(D >= 2, "a heap node needs at least two children");
+public:
+    struct Handle {
+        std::uint32_t id;
+        std::uint32_t generation;
+
+        bool operator==(const Handle& other) const = default;
+    };
+private:
+    struct Slot {
+        std::size_t pos;
+        std::uint32_t generation;
+    };
+
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    std::vector<T> data_;
+    [[no_unique_address]] Compare comp_;
+
+    // Handle bookkeeping, filled in once tracked_ is set: ids_[pos] is the
+    // id of the element at pos, slots_[id] where that element sits now.
+    bool tracked_ = false;
+    std::vector<std::uint32_t> ids_;
+    std::vector<Slot> slots_;
+    std::vector<std::uint32_t> freeIds_;
+    // Generation of new slots. clear() raises it past every generation
+    // handed out, so handles taken before it never match a later element.
+    std::uint32_t baseGeneration_ = 0;
+
+    std::size_t bestChild(std::size_t first, std::size_t size) const;
+    template <bool Tracked>
+    void siftUp(std::size_t pos);
+    template <bool Tracked>
+    void siftDown(std::size_t pos);
+    void siftUp(std::size_t pos);
+    template <bool Tracked>
+    void popInto(T&& last);
+    void heapify();
+
+    void startTracking();
+    std::uint32_t takeId();
+    std::size_t position(Handle handle) const;
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using value_compare = Compare;
+
+    static constexpr std::size_t arity = D;
+
+    PriorityQueue() = default;
+    explicit PriorityQueue(const Compare& comp);
+
+    // O(n) bottom-up heap construction
+    template <std::input_iterator It, std::sentinel_for<It> S>
+    PriorityQueue(It first, S last, const Compare& comp = Compare());
+    PriorityQueue(std::initializer_list<T> values, const Compare& comp = Compare());
+
+    PriorityQueue(const PriorityQueue& other) = default;
+    PriorityQueue(PriorityQueue&& other) noexcept = default;
+
+    ~PriorityQueue() = default;
+
+    PriorityQueue& operator=(const PriorityQueue& other) = default;
+    PriorityQueue& operator=(PriorityQueue&& other) noexcept = default;
+
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+    std::size_t capacity() const noexcept;
+    void reserve(std::size_t capacity);
+
+    const T& top() const;
+
+    void push(const T& value);
+    void push(T&& value);
+
+    template <class... Args>
+    void emplace(Args&&... args);
+
+    // Appends every value, then either sifts each one up or rebuilds the
+    // whole heap bottom-up, whichever takes fewer comparisons.
+    void push_range(std::span<const T> values);
+
+    T pop();
+    void clear() noexcept;
+
+    Handle push_handle(const T& value);
+
+    // True while the handled element is still in the queue
+    bool contains(Handle handle) const noexcept;
+    const T& get(Handle handle) const;
+
+    // Replaces the handled element with one that compares at least as high
+    // (a smaller key for a std::greater min-heap) and moves it up.
+    void decrease_key(Handle handle, const T& value);
+
+    void swap(PriorityQueue& other) noexcept;
+};
+
+template <typename T, typename Compare, std::size_t D>
+void swap(PriorityQueue<T, Compare, D>& a, PriorityQueue<T, Compare, D>& b) noexcept;
+
+#include "priority_queue.inl"
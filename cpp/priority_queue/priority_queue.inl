@@ -0,0 +1,353 @@
+#include "priority_queue.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <utility>
+
+// ### Constructors ###
+
+template <typename T, typename Compare, std::size_t D>
+PriorityQueue<T, Compare, D>::PriorityQueue(const Compare& comp) : comp_(comp) {}
+
+template <typename T, typename Compare, std::size_t D>
+template <std::input_iterator It, std::sentinel_for<It> S>
+PriorityQueue<T, Compare, D>::PriorityQueue(It first, S last, const Compare& comp) : comp_(comp) {
+    for (; first != last; ++first) data_.push_back(*first);
+    heapify();
+}
+
+template <typename T, typename Compare, std::size_t D>
+PriorityQueue<T, Compare, D>::PriorityQueue(std::initializer_list<T> values, const Compare& comp)
+    : PriorityQueue(values.begin(), values.end(), comp) {}
+
+// ### Capacity methods ###
+
+template <typename T, typename Compare, std::size_t D>
+std::size_t PriorityQueue<T, Compare, D>::size() const noexcept {
+    return data_.size();
+}
+
+template <typename T, typename Compare, std::size_t D>
+bool PriorityQueue<T, Compare, D>::empty() const noexcept {
+    return data_.empty();
+}
+
+template <typename T, typename Compare, std::size_t D>
+std::size_t PriorityQueue<T, Compare, D>::capacity() const noexcept {
+    return data_.capacity();
+}
+
+template <typename T, typename Compare, std::size_t D>
+void PriorityQueue<T, Compare, D>::reserve(std::size_t capacity) {
+    data_.reserve(capacity);
+    if (tracked_) ids_.reserve(capacity);
+}
+
+// ### Access methods ###
+
+template <typename T, typename Compare, std::size_t D>
+const T& PriorityQueue<T, Compare, D>::top() const {
+    if (empty()) throw std::out_of_range("top on empty priority queue");
+    return data_.front();
+}
+
+// ### Modifier methods ###
+
+template <typename T, typename Compare, std::size_t D>
+void PriorityQueue<T, Compare, D>::push(const T& value) {
+    data_.push_back(value);
+    if (tracked_) ids_.push_back(takeId());
+    siftUp(data_.size() - 1);
+}
+
+template <typename T, typename Compare, std::size_t D>
+void PriorityQueue<T, Compare, D>::push(T&& value) {
+    data_.push_back(std::move(value));
+    if (tracked_) ids_.push_back(takeId());
+    siftUp(data_.size() - 1);
+}
+
+template <typename T, typename Compare, std::size_t D>
+template <class... Args>
+void PriorityQueue<T, Compare, D>::emplace(Args&&... args) {
+    data_.emplace_back(std::forward<Args>(args)...);
+    if (tracked_) ids_.push_back(takeId());
+    siftUp(data_.size() - 1);
+}
+
+template <typename T, typename Compare, std::size_t D>
+void PriorityQueue<T, Compare, D>::push_range(std::span<const T> values) {
+    std::size_t before = data_.size();
+    std::size_t after = before + values.size();
+    data_.reserve(after);
+    if (tracked_) ids_.reserve(after);
+
+    data_.insert(data_.end(), values.begin(), values.end());
+    if (tracked_) {
+        for (std::size_t i = before; i < after; i++) ids_.push_back(takeId());
+    }
+
+    // Sifting each value up costs up to log_D(n) comparisons apiece; a
+    // rebuild costs about D / (D - 1) comparisons per element in total.
+    std::size_t depth = std::bit_width(after) / std::max<std::size_t>(1, std::bit_width(D) - 1) + 1;
+    if (values.size() * depth > 2 * after) {
+        heapify();
+    } else {
+        for (std::size_t i = before; i < after; i++) siftUp(i);
+    }
+}
+
+template <typename T, typename Compare, std::size_t D>
+T PriorityQueue<T, Compare, D>::pop() {
+    if (empty()) throw std::out_of_range("pop on empty priority queue");
+
+    T value = std::move(data_.front());
+    if (tracked_) {
+        Slot& slot = slots_[ids_.front()];
+        slot.pos = npos;
+        slot.generation++;
+        freeIds_.push_back(ids_.front());
+
+        ids_.front() = ids_.back();
+        ids_.pop_back();
+    }
+
+    if (data_.size() > 1) {
+        T last = std::move(data_.back());
+        data_.pop_back();
+        if (tracked_) {
+            popInto<true>(std::move(last));
+        } else {
+            popInto<false>(std::move(last));
+        }
+    } else {
+        data_.pop_back();
+    }
+    return value;
+}
+
+template <typename T, typename Compare, std::size_t D>
+void PriorityQueue<T, Compare, D>::clear() noexcept {
+    for (const Slot& slot : slots_) baseGeneration_ = std::max(baseGeneration_, slot.generation + 1);
+    data_.clear();
+    tracked_ = false;
+    ids_.clear();
+    slots_.clear();
+    freeIds_.clear();
+}
+
+// ### Handle methods ###
+
+template <typename T, typename Compare, std::size_t D>
+PriorityQueue<T, Compare, D>::Handle PriorityQueue<T, Compare, D>::push_handle(const T& value) {
+    startTracking();
+
+    data_.push_back(value);
+    std::uint32_t id = takeId();
+    ids_.push_back(id);
+    siftUp<true>(data_.size() - 1);
+
+    return Handle{id, slots_[id].generation};
+}
+
+template <typename T, typename Compare, std::size_t D>
+bool PriorityQueue<T, Compare, D>::contains(Handle handle) const noexcept {
+    return tracked_ && handle.id < slots_.size() && slots_[handle.id].generation == handle.generation
+        && slots_[handle.id].pos != npos;
+}
+
+template <typename T, typename Compare, std::size_t D>
+const T& PriorityQueue<T, Compare, D>::get(Handle handle) const {
+    return data_[position(handle)];
+}
+
+template <typename T, typename Compare, std::size_t D>
+void PriorityQueue<T, Compare, D>::decrease_key(Handle handle, const T& value) {
+    std::size_t pos = position(handle);
+    if (comp_(value, data_[pos])) throw std::invalid_argument("decrease_key would lower the element's priority");
+
+    data_[pos] = value;
+    siftUp<true>(pos);
+}
+
+template <typename T, typename Compare, std::size_t D>
+void PriorityQueue<T, Compare, D>::startTracking() {
+    if (tracked_) return;
+
+    ids_.resize(data_.size());
+    slots_.resize(data_.size());
+    for (std::size_t i = 0; i < data_.size(); i++) {
+        ids_[i] = static_cast<std::uint32_t>(i);
+        slots_[i] = Slot{i, baseGeneration_};
+    }
+    tracked_ = true;
+}
+
+template <typename T, typename Compare, std::size_t D>
+std::uint32_t PriorityQueue<T, Compare, D>::takeId() {
+    std::size_t pos = data_.size() - 1;
+    if (!freeIds_.empty()) {
+        std::uint32_t id = freeIds_.back();
+        freeIds_.pop_back();
+        slots_[id].pos = pos;
+        return id;
+    }
+    slots_.push_back(Slot{pos, baseGeneration_});
+    return static_cast<std::uint32_t>(slots_.size() - 1);
+}
+
+template <typename T, typename Compare, std::size_t D>
+std::size_t PriorityQueue<T, Compare, D>::position(Handle handle) const {
+    if (!contains(handle)) throw std::out_of_range("handle is not in the priority queue");
+    return slots_[handle.id].pos;
+}
+
+// ### Heap helpers ###
+
+template <typename T, typename Compare, std::size_t D>
+void PriorityQueue<T, Compare, D>::siftUp(std::size_t pos) {
+    if (tracked_) {
+        siftUp<true>(pos);
+    } else {
+        siftUp<false>(pos);
+    }
+}
+
+// Highest-priority child in [first, min(first + D, size)). A full group is
+// scanned with a fixed trip count and a select rather than a branch, so the
+// compiler unrolls it and the outcome is never mispredicted.
+template <typename T, typename Compare, std::size_t D>
+std::size_t PriorityQueue<T, Compare, D>::bestChild(std::size_t first, std::size_t size) const {
+    if (first + D <= size) {
+        const T* group = &data_[first];
+        std::size_t best = 0;
+        for (std::size_t child = 1; child < D; child++) {
+            best = comp_(group[best], group[child]) ? child : best;
+        }
+        return first + best;
+    }
+
+    std::size_t best = first;
+    for (std::size_t child = first + 1; child < size; child++) {
+        best = comp_(data_[best], data_[child]) ? child : best;
+    }
+    return best;
+}
+
+// Both sifts carry the moving element in a hole instead of swapping, so
+// each level costs one move rather than three.
+template <typename T, typename Compare, std::size_t D>
+template <bool Tracked>
+void PriorityQueue<T, Compare, D>::siftUp(std::size_t pos) {
+    T value = std::move(data_[pos]);
+    std::uint32_t id = Tracked ? ids_[pos] : 0;
+
+    while (pos > 0) {
+        std::size_t parent = (pos - 1) / D;
+        if (!comp_(data_[parent], value)) break;
+
+        data_[pos] = std::move(data_[parent]);
+        if constexpr (Tracked) {
+            ids_[pos] = ids_[parent];
+            slots_[ids_[pos]].pos = pos;
+        }
+        pos = parent;
+    }
+
+    data_[pos] = std::move(value);
+    if constexpr (Tracked) {
+        ids_[pos] = id;
+        slots_[id].pos = pos;
+    }
+}
+
+template <typename T, typename Compare, std::size_t D>
+template <bool Tracked>
+void PriorityQueue<T, Compare, D>::siftDown(std::size_t pos) {
+    std::size_t size = data_.size();
+    T value = std::move(data_[pos]);
+    std::uint32_t id = Tracked ? ids_[pos] : 0;
+
+    while (true) {
+        std::size_t first = D * pos + 1;
+        if (first >= size) break;
+
+        std::size_t best = bestChild(first, size);
+        if (!comp_(value, data_[best])) break;
+
+        data_[pos] = std::move(data_[best]);
+        if constexpr (Tracked) {
+            ids_[pos] = ids_[best];
+            slots_[ids_[pos]].pos = pos;
+        }
+        pos = best;
+    }
+
+    data_[pos] = std::move(value);
+    if constexpr (Tracked) {
+        ids_[pos] = id;
+        slots_[id].pos = pos;
+    }
+}
+
+// Replacing the top: the hole left by the popped element is walked down to
+// a leaf along the best children without comparing against `last`, which
+// usually belongs near the bottom anyway, and `last` is sifted up from
+// there. This saves one comparison per level over a plain sift-down.
+template <typename T, typename Compare, std::size_t D>
+template <bool Tracked>
+void PriorityQueue<T, Compare, D>::popInto(T&& last) {
+    std::size_t size = data_.size();
+    std::size_t pos = 0;
+    std::uint32_t id = Tracked ? ids_[0] : 0;
+
+    while (true) {
+        std::size_t first = D * pos + 1;
+        if (first >= size) break;
+
+        std::size_t best = bestChild(first, size);
+        data_[pos] = std::move(data_[best]);
+        if constexpr (Tracked) {
+            ids_[pos] = ids_[best];
+            slots_[ids_[pos]].pos = pos;
+        }
+        pos = best;
+    }
+
+    data_[pos] = std::move(last);
+    if constexpr (Tracked) ids_[pos] = id;
+    siftUp<Tracked>(pos);
+}
+
+template <typename T, typename Compare, std::size_t D>
+void PriorityQueue<T, Compare, D>::heapify() {
+    if (data_.size() < 2) return;
+
+    for (std::size_t pos = (data_.size() - 2) / D + 1; pos-- > 0;) {
+        if (tracked_) {
+            siftDown<true>(pos);
+        } else {
+            siftDown<false>(pos);
+        }
+    }
+}
+
+// ### Swap methods ###
+
+template <typename T, typename Compare, std::size_t D>
+void PriorityQueue<T, Compare, D>::swap(PriorityQueue& other) noexcept {
+    using std::swap;
+    data_.swap(other.data_);
+    swap(comp_, other.comp_);
+    swap(tracked_, other.tracked_);
+    ids_.swap(other.ids_);
+    slots_.swap(other.slots_);
+    freeIds_.swap(other.freeIds_);
+    swap(baseGeneration_, other.baseGeneration_);
+}
+
+template <typename T, typename Compare, std::size_t D>
+void swap(PriorityQueue<T, Compare, D>& a, PriorityQueue<T, Compare, D>& b) noexcept {
+    a.swap(b);
+}
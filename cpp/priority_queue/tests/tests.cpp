@@ -0,0 +1,197 @@
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../priority_queue.hpp"
+
+TEST_CASE("Default construction", "[constructor]") {
+    PriorityQueue<int> queue;
+
+    REQUIRE(queue.size() == 0);
+    REQUIRE(queue.empty());
+}
+
+TEMPLATE_TEST_CASE_SIG("pop returns elements in priority order", "[modifiers]", ((std::size_t D), D), 2, 3, 4, 8) {
+    PriorityQueue<int, std::less<int>, D> queue;
+    std::priority_queue<int> reference;
+    std::mt19937 rng(D);
+
+    for (int i = 0; i < 2000; i++) {
+        int value = static_cast<int>(rng() % 500);
+        queue.push(value);
+        reference.push(value);
+        REQUIRE(queue.top() == reference.top());
+    }
+    while (!reference.empty()) {
+        REQUIRE(queue.pop() == reference.top());
+        reference.pop();
+    }
+    REQUIRE(queue.empty());
+}
+
+TEST_CASE("std::greater makes a min-heap", "[modifiers]") {
+    PriorityQueue<int, std::greater<int>, 8> queue{5, 1, 9, 3, 7};
+
+    REQUIRE(queue.top() == 1);
+    std::vector<int> popped;
+    while (!queue.empty()) popped.push_back(queue.pop());
+    REQUIRE(popped == std::vector<int>{1, 3, 5, 7, 9});
+}
+
+TEST_CASE("Range construction heapifies", "[constructor]") {
+    std::vector<int> values(1000);
+    for (int i = 0; i < 1000; i++) values[i] = (i * 7919) % 1000;
+
+    PriorityQueue<int> queue(values.begin(), values.end());
+    REQUIRE(queue.size() == 1000);
+    for (int expected = 999; expected >= 0; expected--) REQUIRE(queue.pop() == expected);
+}
+
+TEST_CASE("emplace and move-only values", "[modifiers][move]") {
+    PriorityQueue<std::pair<int, std::string>> queue;
+
+    queue.emplace(2, "two");
+    queue.emplace(3, "three");
+    queue.push({1, "one"});
+
+    REQUIRE(queue.pop().second == "three");
+    REQUIRE(queue.pop().second == "two");
+    REQUIRE(queue.pop().second == "one");
+}
+
+TEST_CASE("push_range small and large batches", "[modifiers]") {
+    PriorityQueue<int> queue;
+    std::vector<int> all;
+    std::mt19937 rng(3);
+
+    for (std::size_t batch : {1000u, 3u, 10u, 5000u, 1u}) {
+        std::vector<int> values(batch);
+        for (int& v : values) v = static_cast<int>(rng() % 10000);
+        queue.push_range(values);
+        all.insert(all.end(), values.begin(), values.end());
+        REQUIRE(queue.top() == *std::max_element(all.begin(), all.end()));
+    }
+
+    std::sort(all.begin(), all.end(), std::greater<int>());
+    for (int expected : all) REQUIRE(queue.pop() == expected);
+}
+
+TEST_CASE("decrease_key moves an element towards the top", "[handles]") {
+    PriorityQueue<int, std::greater<int>> queue{40, 50, 60};
+
+    auto a = queue.push_handle(70);
+    auto b = queue.push_handle(80);
+    queue.push(45);
+
+    REQUIRE(queue.get(a) == 70);
+    queue.decrease_key(b, 10);
+    REQUIRE(queue.top() == 10);
+    queue.decrease_key(a, 42);
+
+    std::vector<int> popped;
+    while (!queue.empty()) popped.push_back(queue.pop());
+    REQUIRE(popped == std::vector<int>{10, 40, 42, 45, 50, 60});
+
+    REQUIRE_FALSE(queue.contains(a));
+    REQUIRE_FALSE(queue.contains(b));
+}
+
+TEST_CASE("decrease_key drives Dijkstra-style relaxation", "[handles]") {
+    using Entry = std::pair<int, int>;
+    PriorityQueue<Entry, std::greater<Entry>, 4> queue;
+    std::vector<PriorityQueue<Entry, std::greater<Entry>, 4>::Handle> handles;
+    std::vector<int> key(300);
+    std::mt19937 rng(11);
+
+    for (int i = 0; i < 300; i++) {
+        key[i] = 1000 + static_cast<int>(rng() % 1000);
+        handles.push_back(queue.push_handle({key[i], i}));
+    }
+    for (int round = 0; round < 2000; round++) {
+        int node = static_cast<int>(rng() % 300);
+        if (!queue.contains(handles[node])) continue;
+        int lowered = key[node] - static_cast<int>(rng() % 50);
+        queue.decrease_key(handles[node], {lowered, node});
+        key[node] = lowered;
+
+        if (round % 7 == 0) {
+            Entry top = queue.pop();
+            REQUIRE(top.first == key[top.second]);
+        }
+    }
+
+    Entry previous{-1000000, -1};
+    while (!queue.empty()) {
+        Entry top = queue.pop();
+        REQUIRE(top >= previous);
+        REQUIRE(top.first == key[top.second]);
+        previous = top;
+    }
+}
+
+TEST_CASE("Handles stay valid across push_range and stale ones are rejected", "[handles]") {
+    PriorityQueue<int> queue;
+    queue.push_range(std::vector<int>{1, 2, 3});
+
+    auto handle = queue.push_handle(0);
+    queue.push_range(std::vector<int>(100, 5));
+    REQUIRE(queue.get(handle) == 0);
+
+    queue.decrease_key(handle, 10);
+    REQUIRE(queue.pop() == 10);
+    REQUIRE_FALSE(queue.contains(handle));
+
+    // The freed id is reused with a new generation
+    auto reused = queue.push_handle(-1);
+    REQUIRE(reused.id == handle.id);
+    REQUIRE_FALSE(queue.contains(handle));
+    REQUIRE(queue.contains(reused));
+}
+
+TEST_CASE("Handles taken before clear stay invalid", "[handles]") {
+    PriorityQueue<int> queue;
+    auto popped = queue.push_handle(3);
+    queue.pop();
+    auto handle = queue.push_handle(5);
+    queue.clear();
+
+    auto fresh = queue.push_handle(7);
+    auto second = queue.push_handle(8);
+    REQUIRE_FALSE(queue.contains(handle));
+    REQUIRE_FALSE(queue.contains(popped));
+    REQUIRE_THROWS_AS(queue.get(handle), std::out_of_range);
+    REQUIRE(queue.get(fresh) == 7);
+    REQUIRE(queue.get(second) == 8);
+}
+
+TEST_CASE("Copy and swap", "[operators]") {
+    PriorityQueue<int> a{3, 1, 2};
+    PriorityQueue<int> b = a;
+    b.push(10);
+
+    REQUIRE(a.top() == 3);
+    REQUIRE(b.top() == 10);
+
+    swap(a, b);
+    REQUIRE(a.size() == 4);
+    REQUIRE(b.size() == 3);
+}
+
+TEST_CASE("Errors", "[exceptions]") {
+    PriorityQueue<int> queue;
+    REQUIRE_THROWS_AS(queue.top(), std::out_of_range);
+    REQUIRE_THROWS_AS(queue.pop(), std::out_of_range);
+
+    auto handle = queue.push_handle(5);
+    REQUIRE_THROWS_AS(queue.decrease_key(handle, 1), std::invalid_argument);
+    queue.clear();
+    REQUIRE_THROWS_AS(queue.get(handle), std::out_of_range);
+    REQUIRE_THROWS_AS(queue.decrease_key(handle, 9), std::out_of_range);
+}
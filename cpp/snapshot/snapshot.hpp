@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+
+// On-disk layout: a fixed header followed by `count` elements stored back to
+// back, starting at a 64-byte aligned payload offset.
+struct SnapshotHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t headerSize;
+    std::uint64_t elementSize;
+    std::uint64_t elementAlign;
+    std::uint64_t count;
+    std::uint64_t payloadOffset;
+};
+
+inline constexpr char snapshotMagic[8] = {'D', 'S', 'A', 'S', 'N', 'A', 'P', '\0'};
+inline constexpr std::uint32_t snapshotVersion = 1;
+inline constexpr std::uint64_t snapshotPayloadAlign = 64;
+
+template <typename T>
+class SnapshotWriter {
+    static_assert(std::is_trivially_copyable_v<T>, "snapshots require trivially copyable elements");
+private:
+    std::FILE* file_ = nullptr;
+    std::string path_;
+public:
+    SnapshotWriter(const std::string& path, std::size_t count);
+    SnapshotWriter(const SnapshotWriter& other) = delete;
+
+    ~SnapshotWriter() noexcept;
+
+    SnapshotWriter& operator=(const SnapshotWriter& other) = delete;
+
+    void write(const T* values, std::size_t count);
+    void close();
+};
+
+template <typename T>
+class SnapshotReader {
+    static_assert(std::is_trivially_copyable_v<T>, "snapshots require trivially copyable elements");
+private:
+    std::FILE* file_ = nullptr;
+    std::string path_;
+    std::size_t count_ = 0;
+public:
+    explicit SnapshotReader(const std::string& path);
+    SnapshotReader(const SnapshotReader& other) = delete;
+
+    ~SnapshotReader() noexcept;
+
+    SnapshotReader& operator=(const SnapshotReader& other) = delete;
+
+    std::size_t count() const noexcept;
+
+    void read(T* values, std::size_t count);
+};
+
+// Read-only, zero-copy access to a snapshot file through mmap.
+template <typename T>
+class SnapshotView {
+    static_assert(std::is_trivially_copyable_v<T>, "snapshots require trivially copyable elements");
+private:
+    void* mapping_ = nullptr;
+    std::size_t mappingSize_ = 0;
+    const T* data_ = nullptr;
+    std::size_t size_ = 0;
+public:
+    using const_iterator = const T*;
+
+    explicit SnapshotView(const std::string& path);
+    SnapshotView(const SnapshotView& other) = delete;
+    SnapshotView(SnapshotView&& other) noexcept;
+
+    ~SnapshotView() noexcept;
+
+    SnapshotView& operator=(const SnapshotView& other) = delete;
+    SnapshotView& operator=(SnapshotView&& other) noexcept;
+
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+
+    const T& at(std::size_t pos) const;
+    const T& operator[](std::size_t pos) const noexcept;
+
+    const T* data() const noexcept;
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+};
+
+#include "snapshot.inl"
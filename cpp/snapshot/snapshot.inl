@@ -0,0 +1,222 @@
+#include "snapshot.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ### Header helpers ###
+
+template <typename T>
+SnapshotHeader makeSnapshotHeader(std::size_t count) {
+    SnapshotHeader header{};
+    std::memcpy(header.magic, snapshotMagic, sizeof(header.magic));
+    header.version = snapshotVersion;
+    header.headerSize = sizeof(SnapshotHeader);
+    header.elementSize = sizeof(T);
+    header.elementAlign = alignof(T);
+    header.count = count;
+    header.payloadOffset = (sizeof(SnapshotHeader) + snapshotPayloadAlign - 1) / snapshotPayloadAlign * snapshotPayloadAlign;
+    return header;
+}
+
+template <typename T>
+void checkSnapshotHeader(const SnapshotHeader& header, const std::string& path) {
+    if (std::memcmp(header.magic, snapshotMagic, sizeof(header.magic)) != 0) {
+        throw std::runtime_error("not a snapshot file: " + path);
+    }
+    if (header.version != snapshotVersion) {
+        throw std::runtime_error("unsupported snapshot version in " + path);
+    }
+    if (header.elementSize != sizeof(T) || header.elementAlign != alignof(T)) {
+        throw std::runtime_error("snapshot element type mismatch in " + path);
+    }
+    if (header.payloadOffset < sizeof(SnapshotHeader) || header.payloadOffset % alignof(T) != 0) {
+        throw std::runtime_error("corrupt snapshot header in " + path);
+    }
+}
+
+// ### SnapshotWriter ###
+
+template <typename T>
+SnapshotWriter<T>::SnapshotWriter(const std::string& path, std::size_t count) : path_(path) {
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) throw std::runtime_error("cannot open snapshot for writing: " + path);
+
+    SnapshotHeader header = makeSnapshotHeader<T>(count);
+    char padding[snapshotPayloadAlign] = {};
+    if (std::fwrite(&header, sizeof(header), 1, file_) != 1 ||
+        std::fwrite(padding, 1, header.payloadOffset - sizeof(header), file_) != header.payloadOffset - sizeof(header)) {
+        std::fclose(file_);
+        file_ = nullptr;
+        throw std::runtime_error("cannot write snapshot header: " + path);
+    }
+}
+
+template <typename T>
+SnapshotWriter<T>::~SnapshotWriter() noexcept {
+    if (file_) std::fclose(file_);
+}
+
+template <typename T>
+void SnapshotWriter<T>::write(const T* values, std::size_t count) {
+    if (std::fwrite(values, sizeof(T), count, file_) != count) {
+        throw std::runtime_error("cannot write snapshot payload: " + path_);
+    }
+}
+
+template <typename T>
+void SnapshotWriter<T>::close() {
+    if (!file_) return;
+
+    int status = std::fclose(file_);
+    file_ = nullptr;
+    if (status != 0) throw std::runtime_error("cannot flush snapshot: " + path_);
+}
+
+// ### SnapshotReader ###
+
+template <typename T>
+SnapshotReader<T>::SnapshotReader(const std::string& path) : path_(path) {
+    file_ = std::fopen(path.c_str(), "rb");
+    if (!file_) throw std::runtime_error("cannot open snapshot: " + path);
+
+    SnapshotHeader header;
+    try {
+        if (std::fread(&header, sizeof(header), 1, file_) != 1) {
+            throw std::runtime_error("truncated snapshot header in " + path);
+        }
+        checkSnapshotHeader<T>(header, path);
+
+        // Callers size their buffers from count(), so it must fit in the file
+        struct stat info;
+        if (::fstat(::fileno(file_), &info) != 0) {
+            throw std::runtime_error("cannot stat snapshot: " + path);
+        }
+        auto fileSize = static_cast<std::size_t>(info.st_size);
+        if (header.payloadOffset > fileSize || header.count > (fileSize - header.payloadOffset) / sizeof(T)) {
+            throw std::runtime_error("truncated snapshot payload in " + path);
+        }
+
+        if (std::fseek(file_, static_cast<long>(header.payloadOffset), SEEK_SET) != 0) {
+            throw std::runtime_error("cannot seek to snapshot payload in " + path);
+        }
+    } catch (...) {
+        std::fclose(file_);
+        file_ = nullptr;
+        throw;
+    }
+
+    count_ = header.count;
+}
+
+template <typename T>
+SnapshotReader<T>::~SnapshotReader() noexcept {
+    if (file_) std::fclose(file_);
+}
+
+template <typename T>
+std::size_t SnapshotReader<T>::count() const noexcept { return count_; }
+
+template <typename T>
+void SnapshotReader<T>::read(T* values, std::size_t count) {
+    if (std::fread(values, sizeof(T), count, file_) != count) {
+        throw std::runtime_error("truncated snapshot payload in " + path_);
+    }
+}
+
+// ### SnapshotView ###
+
+template <typename T>
+SnapshotView<T>::SnapshotView(const std::string& path) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("cannot open snapshot: " + path);
+
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(SnapshotHeader)) {
+        ::close(fd);
+        throw std::runtime_error("truncated snapshot header in " + path);
+    }
+
+    mappingSize_ = static_cast<std::size_t>(info.st_size);
+    mapping_ = ::mmap(nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = nullptr;
+        throw std::runtime_error("cannot map snapshot: " + path);
+    }
+
+    try {
+        const auto* header = static_cast<const SnapshotHeader*>(mapping_);
+        checkSnapshotHeader<T>(*header, path);
+        // Divides rather than multiplies, so a corrupt count cannot wrap past the check
+        if (header->payloadOffset > mappingSize_ || header->count > (mappingSize_ - header->payloadOffset) / sizeof(T)) {
+            throw std::runtime_error("truncated snapshot payload in " + path);
+        }
+
+        data_ = reinterpret_cast<const T*>(static_cast<const char*>(mapping_) + header->payloadOffset);
+        size_ = header->count;
+    } catch (...) {
+        ::munmap(mapping_, mappingSize_);
+        throw;
+    }
+}
+
+template <typename T>
+SnapshotView<T>::SnapshotView(SnapshotView&& other) noexcept
+    : mapping_(other.mapping_), mappingSize_(other.mappingSize_), data_(other.data_), size_(other.size_) {
+    other.mapping_ = nullptr;
+    other.mappingSize_ = 0;
+    other.data_ = nullptr;
+    other.size_ = 0;
+}
+
+template <typename T>
+SnapshotView<T>::~SnapshotView() noexcept {
+    if (mapping_) ::munmap(mapping_, mappingSize_);
+}
+
+template <typename T>
+SnapshotView<T>& SnapshotView<T>::operator=(SnapshotView&& other) noexcept {
+    if (this != &other) {
+        if (mapping_) ::munmap(mapping_, mappingSize_);
+
+        mapping_ = other.mapping_;
+        mappingSize_ = other.mappingSize_;
+        data_ = other.data_;
+        size_ = other.size_;
+
+        other.mapping_ = nullptr;
+        other.mappingSize_ = 0;
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+template <typename T>
+std::size_t SnapshotView<T>::size() const noexcept { return size_; }
+
+template <typename T>
+bool SnapshotView<T>::empty() const noexcept { return size_ == 0; }
+
+template <typename T>
+const T& SnapshotView<T>::at(std::size_t pos) const {
+    if (pos >= size_) throw std::out_of_range("at pos out of range");
+    return data_[pos];
+}
+
+template <typename T>
+const T& SnapshotView<T>::operator[](std::size_t pos) const noexcept { return data_[pos]; }
+
+template <typename T>
+const T* SnapshotView<T>::data() const noexcept { return data_; }
+
+template <typename T>
+SnapshotView<T>::const_iterator SnapshotView<T>::begin() const noexcept { return data_; }
+
+template <typename T>
+SnapshotView<T>::const_iterator SnapshotView<T>::end() const noexcept { return data_ + size_; }
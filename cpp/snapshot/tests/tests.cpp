@@ -0,0 +1,152 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "../snapshot.hpp"
+#include "list.hpp"
+#include "stack.hpp"
+
+static std::string tempPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+TEST_CASE("list save and load round trip", "[list]") {
+    std::string path = tempPath("dsa_snapshot_list.bin");
+
+    SinglyLinkedList<std::int64_t> list;
+    for (std::int64_t i = 0; i < 100000; ++i) list.push_back(i * 3);
+    list.save(path);
+
+    auto loaded = SinglyLinkedList<std::int64_t>::load(path);
+    REQUIRE(loaded.size() == list.size());
+    REQUIRE(loaded.front() == 0);
+    REQUIRE(loaded.back() == 99999 * 3);
+    REQUIRE(loaded.fragmentation() == 0.0);
+
+    loaded.push_back(7);
+    loaded.pop_front();
+    REQUIRE(loaded.front() == 3);
+    REQUIRE(loaded.back() == 7);
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("empty list round trip", "[list]") {
+    std::string path = tempPath("dsa_snapshot_empty.bin");
+
+    SinglyLinkedList<int> list;
+    list.save(path);
+
+    auto loaded = SinglyLinkedList<int>::load(path);
+    REQUIRE(loaded.empty());
+
+    SnapshotView<int> view(path);
+    REQUIRE(view.empty());
+    REQUIRE(view.begin() == view.end());
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("stack save and load round trip", "[stack]") {
+    std::string path = tempPath("dsa_snapshot_stack.bin");
+
+    Stack<double> stack;
+    for (int i = 0; i < 1000; ++i) stack.push(i * 0.5);
+    stack.save(path);
+
+    auto loaded = Stack<double>::load(path);
+    REQUIRE(loaded == stack);
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("view reads elements in place", "[view]") {
+    std::string path = tempPath("dsa_snapshot_view.bin");
+
+    SinglyLinkedList<std::uint32_t> list;
+    for (std::uint32_t i = 0; i < 5000; ++i) list.push_back(i);
+    list.save(path);
+
+    SnapshotView<std::uint32_t> view(path);
+    REQUIRE(view.size() == 5000);
+    REQUIRE(view.at(0) == 0);
+    REQUIRE(view.at(4999) == 4999);
+    REQUIRE(view[1234] == 1234);
+    REQUIRE_THROWS_AS(view.at(5000), std::out_of_range);
+
+    std::uint64_t sum = 0;
+    for (auto value : view) sum += value;
+    REQUIRE(sum == 4999ull * 5000 / 2);
+
+    SnapshotView<std::uint32_t> moved(std::move(view));
+    REQUIRE(moved.size() == 5000);
+    REQUIRE(view.empty());
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("invalid snapshots are rejected", "[errors]") {
+    std::string path = tempPath("dsa_snapshot_bad.bin");
+
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "definitely not a snapshot file, but long enough for a header";
+    }
+    REQUIRE_THROWS_AS(SnapshotView<int>(path), std::runtime_error);
+    REQUIRE_THROWS_AS(SinglyLinkedList<int>::load(path), std::runtime_error);
+
+    Stack<std::int64_t> stack;
+    stack.push(1);
+    stack.save(path);
+    REQUIRE_THROWS_AS(Stack<std::int32_t>::load(path), std::runtime_error);
+    REQUIRE_THROWS_AS(SnapshotView<std::int32_t>(path), std::runtime_error);
+
+    std::filesystem::resize_file(path, 70);
+    REQUIRE_THROWS_AS(Stack<std::int64_t>::load(path), std::runtime_error);
+    REQUIRE_THROWS_AS(SnapshotView<std::int64_t>(path), std::runtime_error);
+
+    REQUIRE_THROWS_AS(SnapshotView<int>(tempPath("dsa_snapshot_missing.bin")), std::runtime_error);
+
+    // A count whose byte size wraps around to a small number
+    stack.save(path);
+    {
+        std::fstream patch(path, std::ios::binary | std::ios::in | std::ios::out);
+        std::uint64_t count = std::uint64_t(1) << 61;
+        patch.seekp(offsetof(SnapshotHeader, count));
+        patch.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    }
+    REQUIRE_THROWS_AS(SnapshotView<std::int64_t>(path), std::runtime_error);
+    REQUIRE_THROWS_AS(Stack<std::int64_t>::load(path), std::runtime_error);
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("truncated payloads are rejected before loading", "[errors]") {
+    std::string path = tempPath("dsa_snapshot_truncated.bin");
+    // Keeps the header and the first ten elements
+    auto cut = [&] {
+        SnapshotHeader header;
+        std::ifstream in(path, std::ios::binary);
+        in.read(reinterpret_cast<char*>(&header), sizeof(header));
+        return header.payloadOffset + 10 * sizeof(std::int64_t);
+    };
+
+    Stack<std::int64_t> stack;
+    for (std::int64_t i = 0; i < 100; i++) stack.push(i);
+    stack.save(path);
+    std::filesystem::resize_file(path, cut());
+    REQUIRE_THROWS_AS(Stack<std::int64_t>::load(path), std::runtime_error);
+
+    SinglyLinkedList<std::int64_t> list;
+    for (std::int64_t i = 0; i < 100; i++) list.push_back(i);
+    list.save(path);
+    std::filesystem::resize_file(path, cut());
+    REQUIRE_THROWS_AS(SinglyLinkedList<std::int64_t>::load(path), std::runtime_error);
+
+    std::remove(path.c_str());
+}
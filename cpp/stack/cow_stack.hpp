@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+// Stack whose storage is a chain of fixed-size chunks, each reference
+// counted. snapshot() and copies share the chain in O(1); afterwards the
+// owner copies a chunk only when it writes to one that is still shared,
+// which is at most the top chunk per snapshot.
+//
+// All member functions of one CowStack must be called from one thread at a
+// time, as with any container. A Snapshot never changes once taken, so it
+// can be read, copied and dropped on other threads while the owner keeps
+// pushing and popping.
+template <typename T>
+class CowStack {
+public:
+    static constexpr std::size_t chunkCapacity = std::max<std::size_t>(16, 4096 / sizeof(T));
+private:
+    struct Chunk {
+        std::atomic<std::size_t> refs{1};
+        // Owns one reference to the chunk below
+        Chunk* below = nullptr;
+        // Constructed elements; may exceed what the owner sees after pops
+        // from a chunk that was shared at the time
+        std::size_t size = 0;
+        alignas(T) unsigned char storage[chunkCapacity * sizeof(T)];
+
+        T* items() noexcept { return reinterpret_cast<T*>(storage); }
+        const T* items() const noexcept { return reinterpret_cast<const T*>(storage); }
+    };
+
+    Chunk* top_ = nullptr;
+    std::size_t topCount_ = 0;
+    std::size_t size_ = 0;
+
+    // Set once top_ is known to be unshared. Only this stack can share it
+    // again, so the flag saves an atomic load on every push and pop.
+    mutable bool topOwned_ = false;
+
+    // An emptied, unshared chunk kept to avoid reallocating when the stack
+    // moves back and forth across a chunk boundary
+    Chunk* spare_ = nullptr;
+
+    static Chunk* retain(Chunk* chunk) noexcept;
+    static void release(Chunk* chunk) noexcept;
+    static bool unique(const Chunk* chunk) noexcept;
+    static void trim(Chunk* chunk, std::size_t count) noexcept;
+
+    Chunk* writableTop();
+    void dropTop() noexcept;
+public:
+    class Snapshot {
+    private:
+        Chunk* top_ = nullptr;
+        std::size_t topCount_ = 0;
+        std::size_t size_ = 0;
+
+        friend class CowStack;
+        Snapshot(Chunk* top, std::size_t topCount, std::size_t size) noexcept;
+    public:
+        // Walks from the top of the stack down
+        class const_iterator {
+        private:
+            const Chunk* chunk_ = nullptr;
+            std::size_t index_ = 0;
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+
+            const_iterator() = default;
+            const_iterator(const Chunk* chunk, std::size_t index) noexcept : chunk_(chunk), index_(index) {}
+
+            const T& operator*() const { return chunk_->items()[index_ - 1]; }
+            const T* operator->() const { return &chunk_->items()[index_ - 1]; }
+
+            const_iterator& operator++() {
+                if (--index_ == 0) {
+                    chunk_ = chunk_->below;
+                    index_ = chunk_ ? chunkCapacity : 0;
+                }
+                return *this;
+            }
+
+            const_iterator operator++(int) {
+                const_iterator tmp(*this);
+                ++*this;
+                return tmp;
+            }
+
+            friend bool operator==(const const_iterator& a, const const_iterator& b) = default;
+        };
+
+        Snapshot() = default;
+        Snapshot(const Snapshot& other) noexcept;
+        Snapshot(Snapshot&& other) noexcept;
+
+        ~Snapshot() noexcept;
+
+        Snapshot& operator=(Snapshot other) noexcept;
+
+        std::size_t size() const noexcept;
+        bool empty() const noexcept;
+        const T& top() const;
+
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+
+        // Bottom of the stack first, like Stack::data()
+        std::vector<T> to_vector() const;
+    };
+
+    CowStack() = default;
+    CowStack(const CowStack& other) noexcept;
+    CowStack(CowStack&& other) noexcept;
+
+    ~CowStack() noexcept;
+
+    CowStack& operator=(CowStack other) noexcept;
+
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+
+    const T& top() const;
+    T& top();
+
+    void push(const T& element);
+    void push(T&& element);
+
+    template <class... Args>
+    void emplace(Args&&... args);
+
+    T pop();
+    void clear() noexcept;
+
+    Snapshot snapshot() const noexcept;
+
+    void swap(CowStack& other) noexcept;
+};
+
+template <typename T>
+void swap(CowStack<T>& a, CowStack<T>& b) noexcept;
+
+#include "cow_stack.inl"
@@ -0,0 +1,295 @@
+#include "cow_stack.hpp"
+
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+// ### Chunk helpers ###
+
+template <typename T>
+CowStack<T>::Chunk* CowStack<T>::retain(Chunk* chunk) noexcept {
+    if (chunk) chunk->refs.fetch_add(1, std::memory_order_relaxed);
+    return chunk;
+}
+
+// Drops one reference and frees every chunk down the chain that it was
+// the last reference to.
+template <typename T>
+void CowStack<T>::release(Chunk* chunk) noexcept {
+    while (chunk && chunk->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        Chunk* below = chunk->below;
+        trim(chunk, 0);
+        delete chunk;
+        chunk = below;
+    }
+}
+
+// Acquire pairs with the release in release(): once the count reads 1,
+// every other holder has finished reading the chunk.
+template <typename T>
+bool CowStack<T>::unique(const Chunk* chunk) noexcept {
+    return chunk->refs.load(std::memory_order_acquire) == 1;
+}
+
+template <typename T>
+void CowStack<T>::trim(Chunk* chunk, std::size_t count) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        std::destroy(chunk->items() + count, chunk->items() + chunk->size);
+    }
+    chunk->size = count;
+}
+
+// Makes the top chunk safe to write, copying it first if a snapshot or a
+// copy still shares it.
+template <typename T>
+CowStack<T>::Chunk* CowStack<T>::writableTop() {
+    if (topOwned_) return top_;
+    if (unique(top_)) {
+        if (top_->size > topCount_) trim(top_, topCount_);
+        topOwned_ = true;
+        return top_;
+    }
+
+    Chunk* copy = spare_ ? std::exchange(spare_, nullptr) : new Chunk;
+    try {
+        std::uninitialized_copy_n(top_->items(), topCount_, copy->items());
+    } catch (...) {
+        delete copy;
+        throw;
+    }
+    copy->size = topCount_;
+    copy->below = retain(top_->below);
+
+    release(top_);
+    top_ = copy;
+    topOwned_ = true;
+    return top_;
+}
+
+template <typename T>
+void CowStack<T>::dropTop() noexcept {
+    Chunk* chunk = top_;
+    if (topOwned_ || unique(chunk)) {
+        top_ = std::exchange(chunk->below, nullptr);
+        trim(chunk, 0);
+        if (spare_) {
+            delete chunk;
+        } else {
+            spare_ = chunk;
+        }
+    } else {
+        top_ = retain(chunk->below);
+        release(chunk);
+    }
+    topCount_ = top_ ? chunkCapacity : 0;
+    topOwned_ = false;
+}
+
+// ### Constructors ###
+
+template <typename T>
+CowStack<T>::CowStack(const CowStack& other) noexcept
+    : top_(retain(other.top_)), topCount_(other.topCount_), size_(other.size_) {
+    other.topOwned_ = false;
+}
+
+template <typename T>
+CowStack<T>::CowStack(CowStack&& other) noexcept
+    : top_(std::exchange(other.top_, nullptr)),
+      topCount_(std::exchange(other.topCount_, 0)),
+      size_(std::exchange(other.size_, 0)),
+      topOwned_(std::exchange(other.topOwned_, false)),
+      spare_(std::exchange(other.spare_, nullptr)) {}
+
+// ### Destructor ###
+
+template <typename T>
+CowStack<T>::~CowStack() noexcept {
+    release(top_);
+    delete spare_;
+}
+
+// ### Operators ###
+
+template <typename T>
+CowStack<T>& CowStack<T>::operator=(CowStack other) noexcept {
+    swap(other);
+    return *this;
+}
+
+// ### Capacity methods ###
+
+template <typename T>
+std::size_t CowStack<T>::size() const noexcept {
+    return size_;
+}
+
+template <typename T>
+bool CowStack<T>::empty() const noexcept {
+    return size_ == 0;
+}
+
+// ### Access methods ###
+
+template <typename T>
+const T& CowStack<T>::top() const {
+    if (empty()) throw std::out_of_range("top on empty stack");
+    return top_->items()[topCount_ - 1];
+}
+
+template <typename T>
+T& CowStack<T>::top() {
+    if (empty()) throw std::out_of_range("top on empty stack");
+    return writableTop()->items()[topCount_ - 1];
+}
+
+// ### Modifier methods ###
+
+template <typename T>
+void CowStack<T>::push(const T& element) {
+    emplace(element);
+}
+
+template <typename T>
+void CowStack<T>::push(T&& element) {
+    emplace(std::move(element));
+}
+
+template <typename T>
+template <class... Args>
+void CowStack<T>::emplace(Args&&... args) {
+    if (!top_ || topCount_ == chunkCapacity) {
+        Chunk* chunk = spare_ ? std::exchange(spare_, nullptr) : new Chunk;
+        try {
+            std::construct_at(chunk->items(), std::forward<Args>(args)...);
+        } catch (...) {
+            spare_ = chunk;
+            throw;
+        }
+        chunk->size = 1;
+        chunk->below = top_;
+        top_ = chunk;
+        topCount_ = 1;
+        topOwned_ = true;
+        size_++;
+        return;
+    }
+
+    Chunk* chunk = writableTop();
+    std::construct_at(chunk->items() + topCount_, std::forward<Args>(args)...);
+    chunk->size++;
+    topCount_++;
+    size_++;
+}
+
+template <typename T>
+T CowStack<T>::pop() {
+    if (empty()) throw std::out_of_range("pop on empty stack");
+
+    // A shared top is left as it is for the snapshots still reading it
+    bool owned = topOwned_ || unique(top_);
+    topOwned_ = owned;
+    T* slot = top_->items() + topCount_ - 1;
+    T value = owned ? std::move(*slot) : *slot;
+    if (owned) trim(top_, topCount_ - 1);
+
+    topCount_--;
+    size_--;
+    if (topCount_ == 0) dropTop();
+
+    return value;
+}
+
+template <typename T>
+void CowStack<T>::clear() noexcept {
+    release(top_);
+    top_ = nullptr;
+    topCount_ = 0;
+    size_ = 0;
+    topOwned_ = false;
+}
+
+// ### Snapshot methods ###
+
+template <typename T>
+CowStack<T>::Snapshot CowStack<T>::snapshot() const noexcept {
+    topOwned_ = false;
+    return Snapshot(retain(top_), topCount_, size_);
+}
+
+template <typename T>
+CowStack<T>::Snapshot::Snapshot(Chunk* top, std::size_t topCount, std::size_t size) noexcept
+    : top_(top), topCount_(topCount), size_(size) {}
+
+template <typename T>
+CowStack<T>::Snapshot::Snapshot(const Snapshot& other) noexcept
+    : top_(retain(other.top_)), topCount_(other.topCount_), size_(other.size_) {}
+
+template <typename T>
+CowStack<T>::Snapshot::Snapshot(Snapshot&& other) noexcept
+    : top_(std::exchange(other.top_, nullptr)),
+      topCount_(std::exchange(other.topCount_, 0)),
+      size_(std::exchange(other.size_, 0)) {}
+
+template <typename T>
+CowStack<T>::Snapshot::~Snapshot() noexcept {
+    release(top_);
+}
+
+template <typename T>
+CowStack<T>::Snapshot& CowStack<T>::Snapshot::operator=(Snapshot other) noexcept {
+    std::swap(top_, other.top_);
+    std::swap(topCount_, other.topCount_);
+    std::swap(size_, other.size_);
+    return *this;
+}
+
+template <typename T>
+std::size_t CowStack<T>::Snapshot::size() const noexcept {
+    return size_;
+}
+
+template <typename T>
+bool CowStack<T>::Snapshot::empty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename T>
+const T& CowStack<T>::Snapshot::top() const {
+    if (empty()) throw std::out_of_range("top on empty snapshot");
+    return top_->items()[topCount_ - 1];
+}
+
+template <typename T>
+CowStack<T>::Snapshot::const_iterator CowStack<T>::Snapshot::begin() const noexcept {
+    return const_iterator(top_, topCount_);
+}
+
+template <typename T>
+CowStack<T>::Snapshot::const_iterator CowStack<T>::Snapshot::end() const noexcept {
+    return const_iterator();
+}
+
+template <typename T>
+std::vector<T> CowStack<T>::Snapshot::to_vector() const {
+    std::vector<T> values(begin(), end());
+    std::reverse(values.begin(), values.end());
+    return values;
+}
+
+// ### Swap methods ###
+
+template <typename T>
+void CowStack<T>::swap(CowStack& other) noexcept {
+    std::swap(top_, other.top_);
+    std::swap(topCount_, other.topCount_);
+    std::swap(size_, other.size_);
+    std::swap(topOwned_, other.topOwned_);
+    std::swap(spare_, other.spare_);
+}
+
+template <typename T>
+void swap(CowStack<T>& a, CowStack<T>& b) noexcept {
+    a.swap(b);
+}
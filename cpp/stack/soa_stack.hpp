@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// Stack of records stored as one contiguous column per field, so a loop over
+// a single field touches only that field's bytes. top() returns a tuple of
+// references into the columns rather than a reference to a stored record.
+template <typename... Fields>
+class SoaStack {
+    static_assert(sizeof...(Fields) > 0, "SoaStack needs at least one field");
+public:
+    using value_type = std::tuple<Fields...>;
+    using reference = std::tuple<Fields&...>;
+    using const_reference = std::tuple<const Fields&...>;
+
+    template <std::size_t I>
+    using field_type = std::tuple_element_t<I, value_type>;
+private:
+    std::tuple<std::vector<Fields>...> columns_;
+    std::size_t size_ = 0;
+
+    void truncate() noexcept;
+    bool overlapsColumns(std::span<const Fields>... sources) const noexcept;
+
+    template <std::size_t... I>
+    reference row(std::size_t pos, std::index_sequence<I...>) noexcept;
+    template <std::size_t... I>
+    const_reference row(std::size_t pos, std::index_sequence<I...>) const noexcept;
+public:
+    SoaStack() = default;
+    SoaStack(const SoaStack& other) = default;
+    SoaStack(SoaStack&& other) noexcept = default;
+
+    ~SoaStack() = default;
+
+    SoaStack& operator=(const SoaStack& other) = default;
+    SoaStack& operator=(SoaStack&& other) noexcept = default;
+
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+    void reserve(std::size_t capacity);
+
+    const_reference top() const;
+    reference top();
+
+    // Whole columns, bottom of the stack first
+    template <std::size_t I>
+    std::span<const field_type<I>> column() const noexcept;
+    template <std::size_t I>
+    std::span<field_type<I>> column() noexcept;
+
+    void push(const Fields&... fields);
+    void push(const value_type& record);
+
+    // Pushes columns[0][i], columns[1][i], ... for every i; all spans must
+    // have the same length.
+    void push_range(std::span<const Fields>... columns);
+
+    value_type pop();
+    void pop_n(std::size_t count);
+
+    // Copies the top out.size() records into the given columns, deepest
+    // first, then pops them.
+    void pop_into(std::span<Fields>... out);
+
+    void clear() noexcept;
+
+    bool operator==(const SoaStack& other) const;
+    bool operator!=(const SoaStack& other) const;
+
+    void swap(SoaStack& other) noexcept;
+};
+
+template <typename... Fields>
+void swap(SoaStack<Fields...>& a, SoaStack<Fields...>& b) noexcept;
+
+#include "soa_stack.inl"
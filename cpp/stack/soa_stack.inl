@@ -0,0 +1,183 @@
+#include "soa_stack.hpp"
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+// ### Capacity methods ###
+
+template <typename... Fields>
+std::size_t SoaStack<Fields...>::size() const noexcept {
+    return size_;
+}
+
+template <typename... Fields>
+bool SoaStack<Fields...>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename... Fields>
+void SoaStack<Fields...>::reserve(std::size_t capacity) {
+    std::apply([&](auto&... column) { (column.reserve(capacity), ...); }, columns_);
+}
+
+// ### Access methods ###
+
+template <typename... Fields>
+SoaStack<Fields...>::const_reference SoaStack<Fields...>::top() const {
+    if (empty()) throw std::out_of_range("top on empty stack");
+    return row(size_ - 1, std::index_sequence_for<Fields...>{});
+}
+
+template <typename... Fields>
+SoaStack<Fields...>::reference SoaStack<Fields...>::top() {
+    if (empty()) throw std::out_of_range("top on empty stack");
+    return row(size_ - 1, std::index_sequence_for<Fields...>{});
+}
+
+template <typename... Fields>
+template <std::size_t I>
+std::span<const typename SoaStack<Fields...>::template field_type<I>> SoaStack<Fields...>::column() const noexcept {
+    return std::get<I>(columns_);
+}
+
+template <typename... Fields>
+template <std::size_t I>
+std::span<typename SoaStack<Fields...>::template field_type<I>> SoaStack<Fields...>::column() noexcept {
+    return std::get<I>(columns_);
+}
+
+template <typename... Fields>
+template <std::size_t... I>
+SoaStack<Fields...>::reference SoaStack<Fields...>::row(std::size_t pos, std::index_sequence<I...>) noexcept {
+    return reference(std::get<I>(columns_)[pos]...);
+}
+
+template <typename... Fields>
+template <std::size_t... I>
+SoaStack<Fields...>::const_reference SoaStack<Fields...>::row(std::size_t pos, std::index_sequence<I...>) const noexcept {
+    return const_reference(std::get<I>(columns_)[pos]...);
+}
+
+// ### Modifier methods ###
+
+template <typename... Fields>
+void SoaStack<Fields...>::push(const Fields&... fields) {
+    try {
+        std::apply([&](auto&... column) { (column.push_back(fields), ...); }, columns_);
+    } catch (...) {
+        truncate();
+        throw;
+    }
+    size_++;
+}
+
+template <typename... Fields>
+void SoaStack<Fields...>::push(const value_type& record) {
+    std::apply([this](const Fields&... fields) { push(fields...); }, record);
+}
+
+template <typename... Fields>
+void SoaStack<Fields...>::push_range(std::span<const Fields>... columns) {
+    std::size_t count = std::get<0>(std::forward_as_tuple(columns...)).size();
+    if (((columns.size() != count) || ...)) throw std::invalid_argument("push_range columns differ in length");
+
+    // A source may view one of this stack's own columns, which the inserts
+    // below can reallocate: such a batch is copied out first.
+    if (overlapsColumns(columns...)) {
+        std::tuple<std::vector<Fields>...> copies(std::vector<Fields>(columns.begin(), columns.end())...);
+        std::apply([this](const std::vector<Fields>&... copy) { push_range(std::span<const Fields>(copy)...); }, copies);
+        return;
+    }
+
+    // No reserve: insert grows each column geometrically on its own
+    try {
+        std::apply([&](auto&... column) { (column.insert(column.end(), columns.begin(), columns.end()), ...); }, columns_);
+    } catch (...) {
+        truncate();
+        throw;
+    }
+    size_ += count;
+}
+
+template <typename... Fields>
+SoaStack<Fields...>::value_type SoaStack<Fields...>::pop() {
+    if (empty()) throw std::out_of_range("pop on empty stack");
+
+    value_type record = std::apply([](auto&... column) { return value_type(std::move(column.back())...); }, columns_);
+    std::apply([](auto&... column) { (column.pop_back(), ...); }, columns_);
+    size_--;
+
+    return record;
+}
+
+template <typename... Fields>
+void SoaStack<Fields...>::pop_n(std::size_t count) {
+    if (count > size_) throw std::out_of_range("pop_n past the bottom of the stack");
+
+    size_ -= count;
+    truncate();
+}
+
+template <typename... Fields>
+void SoaStack<Fields...>::pop_into(std::span<Fields>... out) {
+    std::size_t count = std::get<0>(std::forward_as_tuple(out...)).size();
+    if (((out.size() != count) || ...)) throw std::invalid_argument("pop_into columns differ in length");
+    if (count > size_) throw std::out_of_range("pop_into past the bottom of the stack");
+
+    std::size_t first = size_ - count;
+    std::apply([&](auto&... column) {
+        (std::move(column.begin() + first, column.end(), out.begin()), ...);
+    }, columns_);
+    pop_n(count);
+}
+
+// Drops whatever a column holds past size_, after a partial push or a pop
+template <typename... Fields>
+void SoaStack<Fields...>::truncate() noexcept {
+    std::apply([this](auto&... column) {
+        ((column.size() > size_ ? (void)column.erase(column.begin() + size_, column.end()) : void()), ...);
+    }, columns_);
+}
+
+template <typename... Fields>
+bool SoaStack<Fields...>::overlapsColumns(std::span<const Fields>... sources) const noexcept {
+    std::less<const void*> before;
+    return std::apply([&](const auto&... column) {
+        auto inColumns = [&](const void* p) {
+            return ((!before(p, column.data()) && before(p, column.data() + column.size())) || ...);
+        };
+        return ((!sources.empty() && inColumns(sources.data())) || ...);
+    }, columns_);
+}
+
+template <typename... Fields>
+void SoaStack<Fields...>::clear() noexcept {
+    std::apply([](auto&... column) { (column.clear(), ...); }, columns_);
+    size_ = 0;
+}
+
+// ### Operators ###
+
+template <typename... Fields>
+bool SoaStack<Fields...>::operator==(const SoaStack& other) const {
+    return columns_ == other.columns_;
+}
+
+template <typename... Fields>
+bool SoaStack<Fields...>::operator!=(const SoaStack& other) const {
+    return !(*this == other);
+}
+
+// ### Swap methods ###
+
+template <typename... Fields>
+void SoaStack<Fields...>::swap(SoaStack& other) noexcept {
+    columns_.swap(other.columns_);
+    std::swap(size_, other.size_);
+}
+
+template <typename... Fields>
+void swap(SoaStack<Fields...>& a, SoaStack<Fields...>& b) noexcept {
+    a.swap(b);
+}
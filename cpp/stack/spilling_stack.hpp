@@ -0,0 +1,111 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Stack that keeps only its top `window` segments in memory. Older segments
+// are written to an unlinked temporary file by a background thread
+// (write-behind) and read back one segment ahead of the pops that reach
+// them (read-ahead). At most window + 2 segment buffers exist at a time.
+template <typename T>
+class SpillingStack {
+    static_assert(std::is_trivially_copyable_v<T>, "SpillingStack requires trivially copyable elements");
+private:
+    enum class SegmentState { resident, writing, spilled, reading };
+
+    struct Segment {
+        T* data = nullptr;
+        SegmentState state = SegmentState::resident;
+        // Holds changes the file copy does not have
+        bool dirty = true;
+        // Keep the buffer once an in-flight write finishes
+        bool keep = false;
+    };
+
+    struct Job {
+        bool write;
+        std::size_t index;
+    };
+
+    static constexpr std::size_t bufferAlign = 4096;
+    static constexpr std::size_t spareBuffers = 2;
+    // Read the next spilled segment back once this few segments are resident
+    static constexpr std::size_t readAheadDistance = 2;
+
+    std::size_t segmentSize_;
+    std::size_t window_;
+    std::size_t size_ = 0;
+    int fd_ = -1;
+
+    // The top segment's buffer and how many elements it holds
+    T* top_ = nullptr;
+    std::size_t offset_ = 0;
+
+    // segments_[i] holds elements [i * segmentSize_, (i + 1) * segmentSize_);
+    // every segment from bottomResident_ up is resident or being read back.
+    std::deque<Segment> segments_;
+    std::size_t bottomResident_ = 0;
+
+    std::vector<T*> buffers_;
+    std::vector<T*> pool_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    std::deque<Job> queue_;
+    bool busy_ = false;
+    bool stopping_ = false;
+    std::string error_;
+    std::size_t spilledBytes_ = 0;
+    std::thread worker_;
+
+    void run();
+    void checkError() const;
+    static bool transfer(int fd, bool write, char* data, std::size_t bytes, std::size_t offset) noexcept;
+
+    // Helpers below expect mutex_ to be held
+    T* acquireBuffer(std::unique_lock<std::mutex>& lock);
+    void waitUntilResident(std::unique_lock<std::mutex>& lock, std::size_t index);
+    void bringBack(std::unique_lock<std::mutex>& lock, std::size_t index);
+    void spillBottom(std::unique_lock<std::mutex>& lock);
+    void waitIdle(std::unique_lock<std::mutex>& lock);
+
+    void enterSegment();
+    void leaveSegment();
+public:
+    static constexpr std::size_t defaultSegmentBytes = std::size_t(1) << 20;
+
+    // directory defaults to $TMPDIR, then /tmp
+    explicit SpillingStack(std::size_t segmentSize = defaultSegmentBytes / sizeof(T), std::size_t window = 8, const std::string& directory = "");
+    SpillingStack(const SpillingStack& other) = delete;
+
+    ~SpillingStack() noexcept;
+
+    SpillingStack& operator=(const SpillingStack& other) = delete;
+
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+
+    std::size_t segment_size() const noexcept;
+    std::size_t window() const noexcept;
+
+    // Segments whose buffers are held in memory, and bytes written to the
+    // spill file so far
+    std::size_t resident_segments() const noexcept;
+    std::size_t spilled_bytes() noexcept;
+
+    const T& top() const;
+    T& top();
+
+    void push(const T& element);
+    T pop();
+    void clear();
+};
+
+#include "spilling_stack.inl"
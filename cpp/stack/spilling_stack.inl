@@ -0,0 +1,334 @@
+#include "spilling_stack.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+// ### Constructors ###
+
+template <typename T>
+SpillingStack<T>::SpillingStack(std::size_t segmentSize, std::size_t window, const std::string& directory)
+    : segmentSize_(segmentSize), window_(window) {
+    if (segmentSize_ == 0) throw std::invalid_argument("segment size must be positive");
+    if (window_ == 0) throw std::invalid_argument("window must hold at least one segment");
+
+    std::string dir = directory;
+    if (dir.empty()) {
+        const char* tmp = std::getenv("TMPDIR");
+        dir = tmp && *tmp ? tmp : "/tmp";
+    }
+
+    std::string path = dir + "/spilling_stack.XXXXXX";
+    std::vector<char> name(path.begin(), path.end());
+    name.push_back('\0');
+
+    fd_ = ::mkstemp(name.data());
+    if (fd_ < 0) throw std::runtime_error("cannot create spill file in " + dir);
+    ::unlink(name.data());
+
+    try {
+        worker_ = std::thread(&SpillingStack::run, this);
+    } catch (...) {
+        ::close(fd_);
+        throw;
+    }
+}
+
+// ### Destructor ###
+
+template <typename T>
+SpillingStack<T>::~SpillingStack() noexcept {
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+        queue_.clear();
+    }
+    wake_.notify_all();
+    worker_.join();
+
+    for (T* buffer : buffers_) ::operator delete(buffer, std::align_val_t(std::max(bufferAlign, alignof(T))));
+    ::close(fd_);
+}
+
+// ### Capacity methods ###
+
+template <typename T>
+std::size_t SpillingStack<T>::size() const noexcept {
+    return size_;
+}
+
+template <typename T>
+bool SpillingStack<T>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename T>
+std::size_t SpillingStack<T>::segment_size() const noexcept {
+    return segmentSize_;
+}
+
+template <typename T>
+std::size_t SpillingStack<T>::window() const noexcept {
+    return window_;
+}
+
+template <typename T>
+std::size_t SpillingStack<T>::resident_segments() const noexcept {
+    return segments_.size() - bottomResident_;
+}
+
+template <typename T>
+std::size_t SpillingStack<T>::spilled_bytes() noexcept {
+    std::lock_guard lock(mutex_);
+    return spilledBytes_;
+}
+
+// ### Access methods ###
+
+template <typename T>
+const T& SpillingStack<T>::top() const {
+    if (empty()) throw std::out_of_range("top on empty stack");
+    return top_[offset_ - 1];
+}
+
+template <typename T>
+T& SpillingStack<T>::top() {
+    if (empty()) throw std::out_of_range("top on empty stack");
+    return top_[offset_ - 1];
+}
+
+// ### Modifier methods ###
+
+template <typename T>
+void SpillingStack<T>::push(const T& element) {
+    if (offset_ == segmentSize_ || segments_.empty()) enterSegment();
+    top_[offset_++] = element;
+    size_++;
+}
+
+template <typename T>
+T SpillingStack<T>::pop() {
+    if (empty()) throw std::out_of_range("pop on empty stack");
+
+    // leaveSegment() either moves to the segment below or throws with the
+    // stack untouched, so a failed pop loses nothing.
+    T value = top_[offset_ - 1];
+    if (offset_ == 1 && size_ > 1) {
+        leaveSegment();
+    } else {
+        offset_--;
+    }
+    size_--;
+
+    return value;
+}
+
+template <typename T>
+void SpillingStack<T>::clear() {
+    std::unique_lock lock(mutex_);
+    waitIdle(lock);
+
+    for (Segment& segment : segments_) {
+        if (segment.data) pool_.push_back(segment.data);
+    }
+    segments_.clear();
+    bottomResident_ = 0;
+    top_ = nullptr;
+    offset_ = 0;
+    size_ = 0;
+
+    if (::ftruncate(fd_, 0) != 0 && error_.empty()) error_ = std::string("cannot truncate spill file: ") + std::strerror(errno);
+}
+
+// ### Segment helpers ###
+
+template <typename T>
+void SpillingStack<T>::enterSegment() {
+    std::unique_lock lock(mutex_);
+    checkError();
+
+    while (segments_.size() + 1 - bottomResident_ > window_) spillBottom(lock);
+
+    T* data = acquireBuffer(lock);
+    try {
+        segments_.push_back(Segment{data});
+    } catch (...) {
+        pool_.push_back(data);
+        throw;
+    }
+    top_ = data;
+    offset_ = 0;
+}
+
+// Everything that can throw runs first: bringing the segment below back,
+// the read-ahead and the wait. Until then the old top stays in place, and
+// a failure leaves a consistent stack whose lower segments are at worst
+// already on their way back.
+template <typename T>
+void SpillingStack<T>::leaveSegment() {
+    std::unique_lock lock(mutex_);
+
+    std::size_t below = segments_.size() - 2;
+    if (bottomResident_ > below) {
+        bringBack(lock, below);
+        bottomResident_ = below;
+    }
+    if (bottomResident_ > 0 && segments_.size() - 1 - bottomResident_ <= readAheadDistance) {
+        bringBack(lock, bottomResident_ - 1);
+        bottomResident_--;
+    }
+    waitUntilResident(lock, below);
+
+    // pool_ has room for every buffer, so this cannot allocate
+    pool_.push_back(segments_.back().data);
+    segments_.pop_back();
+
+    // The caller may push into it, so its file copy can no longer be trusted
+    segments_.back().dirty = true;
+    top_ = segments_.back().data;
+    offset_ = segmentSize_;
+}
+
+template <typename T>
+void SpillingStack<T>::spillBottom(std::unique_lock<std::mutex>& lock) {
+    std::size_t index = bottomResident_;
+    waitUntilResident(lock, index);
+    bottomResident_++;
+
+    Segment& segment = segments_[index];
+    if (!segment.dirty) {
+        pool_.push_back(segment.data);
+        segment.data = nullptr;
+        segment.state = SegmentState::spilled;
+        return;
+    }
+
+    segment.state = SegmentState::writing;
+    queue_.push_back({true, index});
+    wake_.notify_one();
+}
+
+template <typename T>
+void SpillingStack<T>::bringBack(std::unique_lock<std::mutex>& lock, std::size_t index) {
+    Segment& segment = segments_[index];
+    if (segment.state == SegmentState::writing) {
+        // The buffer still holds the data: keep it rather than re-reading
+        segment.keep = true;
+    } else if (segment.state == SegmentState::spilled) {
+        T* data = acquireBuffer(lock);
+        try {
+            queue_.push_back({false, index});
+        } catch (...) {
+            pool_.push_back(data);
+            throw;
+        }
+        segment.data = data;
+        segment.state = SegmentState::reading;
+        wake_.notify_one();
+    }
+}
+
+template <typename T>
+void SpillingStack<T>::waitUntilResident(std::unique_lock<std::mutex>& lock, std::size_t index) {
+    done_.wait(lock, [&] { return segments_[index].state == SegmentState::resident; });
+    checkError();
+}
+
+template <typename T>
+T* SpillingStack<T>::acquireBuffer(std::unique_lock<std::mutex>& lock) {
+    while (true) {
+        checkError();
+        if (!pool_.empty()) {
+            T* buffer = pool_.back();
+            pool_.pop_back();
+            return buffer;
+        }
+        if (buffers_.size() < window_ + spareBuffers) {
+            // Room for every buffer up front: returning one to pool_ must
+            // not allocate, least of all on the worker thread
+            buffers_.reserve(window_ + spareBuffers);
+            pool_.reserve(window_ + spareBuffers);
+            T* buffer = static_cast<T*>(::operator new(segmentSize_ * sizeof(T), std::align_val_t(std::max(bufferAlign, alignof(T)))));
+            buffers_.push_back(buffer);
+            return buffer;
+        }
+        // Every buffer is in use or in flight: wait for a write to land
+        done_.wait(lock);
+    }
+}
+
+template <typename T>
+void SpillingStack<T>::waitIdle(std::unique_lock<std::mutex>& lock) {
+    done_.wait(lock, [&] { return queue_.empty() && !busy_; });
+}
+
+template <typename T>
+void SpillingStack<T>::checkError() const {
+    if (!error_.empty()) throw std::runtime_error(error_);
+}
+
+// ### Background I/O ###
+
+template <typename T>
+void SpillingStack<T>::run() {
+    std::unique_lock lock(mutex_);
+    while (true) {
+        wake_.wait(lock, [&] { return stopping_ || !queue_.empty(); });
+        if (stopping_) return;
+
+        Job job = queue_.front();
+        queue_.pop_front();
+        busy_ = true;
+
+        Segment& segment = segments_[job.index];
+        char* data = reinterpret_cast<char*>(segment.data);
+        std::size_t bytes = segmentSize_ * sizeof(T);
+
+        lock.unlock();
+        bool ok = transfer(fd_, job.write, data, bytes, job.index * bytes);
+        int failure = errno;
+        lock.lock();
+
+        busy_ = false;
+        if (!ok && error_.empty()) {
+            error_ = std::string(job.write ? "cannot write" : "cannot read") + " spill file: " + std::strerror(failure);
+        }
+
+        if (job.write && ok) spilledBytes_ += bytes;
+        if (job.write && ok && !segment.keep) {
+            pool_.push_back(segment.data);
+            segment.data = nullptr;
+            segment.state = SegmentState::spilled;
+        } else {
+            // A failed write keeps its data in memory; the error is raised
+            // by the next call that waits on the worker.
+            segment.state = SegmentState::resident;
+            segment.dirty = !ok;
+            segment.keep = false;
+        }
+        done_.notify_all();
+    }
+}
+
+template <typename T>
+bool SpillingStack<T>::transfer(int fd, bool write, char* data, std::size_t bytes, std::size_t offset) noexcept {
+    while (bytes > 0) {
+        ssize_t n = write ? ::pwrite(fd, data, bytes, static_cast<off_t>(offset))
+                          : ::pread(fd, data, bytes, static_cast<off_t>(offset));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) {
+            if (n == 0) errno = EIO;
+            return false;
+        }
+        data += n;
+        bytes -= static_cast<std::size_t>(n);
+        offset += static_cast<std::size_t>(n);
+    }
+    return true;
+}
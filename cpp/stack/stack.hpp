@@ -1,11 +1,23 @@
 #pragma once
 
+#include <concepts>
+#include <iterator>
+#include <ranges>
+#include <span>
+#include <string>
+#include <type_traits>
 #include <vector>
 
-template <typename T>
+#include "stats.hpp"
+
+template <typename T, typename Stats = NoStats>
 class Stack {
 private:
     std::vector<T> data_;
+    [[no_unique_address]] mutable Stats stats_;
+
+    void recordGrowth() noexcept;
+    void growFor(std::size_t count);
 public:
     Stack() = default;
     Stack(const Stack& other) = default;
@@ -18,24 +30,53 @@ public:
 
     std::size_t size() const noexcept;
     bool empty() const noexcept;
+    std::size_t capacity() const noexcept;
+    void reserve(std::size_t capacity);
+    void shrink_to_fit();
 
     const T& top() const;
     T& top();
 
+    const T* data() const noexcept;
+
     void push(const T& element);
     void push(T&& element);
 
     template <class... Args>
     void emplace(Args&&... args);
 
+    // Bulk transfers grow the storage at most once and, for trivially
+    // copyable T and contiguous input, copy with a single memcpy. The first
+    // element of a range ends up deepest, as if pushed one by one.
+    template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+    void push_range(R&& range);
+    void append(std::span<const T> values);
+
     T pop();
+
+    // Remove the top `count` elements; the out overloads write them deepest
+    // first, in the same order SoaStack::pop_into uses.
+    void pop_n(std::size_t count);
+    template <std::output_iterator<T> Out>
+    Out pop_n(std::size_t count, Out out);
+    void pop_into(std::span<T> out);
+
     void clear() noexcept;
 
     bool operator==(const Stack& other) const;
     bool operator!=(const Stack& other) const;
 
     void swap(Stack& other) noexcept;
+
+    ContainerStats stats() const noexcept;
+    void reset_stats() noexcept;
+
+    void save(const std::string& path) const requires std::is_trivially_copyable_v<T>;
+    static Stack load(const std::string& path) requires std::is_trivially_copyable_v<T>;
 };
 
-template <typename T>
-void swap(Stack<T>& a, Stack<T>& b) noexcept;
+template <typename T, typename Stats>
+void swap(Stack<T, Stats>& a, Stack<T, Stats>& b) noexcept;
+
+#include "stack.inl"
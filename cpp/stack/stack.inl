@@ -1,54 +1,111 @@
 #include "stack.hpp"
+#include "snapshot.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <functional>
 #include <stdexcept>
 
 // ### Capacity methods ###
 
-template <typename T>
-std::size_t Stack<T>::size() const noexcept {
+template <typename T, typename Stats>
+std::size_t Stack<T, Stats>::size() const noexcept {
     return data_.size();
 }
 
-template <typename T>
-bool Stack<T>::empty() const noexcept {
+template <typename T, typename Stats>
+bool Stack<T, Stats>::empty() const noexcept {
     return data_.empty();
 }
 
+template <typename T, typename Stats>
+std::size_t Stack<T, Stats>::capacity() const noexcept {
+    return data_.capacity();
+}
+
+template <typename T, typename Stats>
+void Stack<T, Stats>::reserve(std::size_t capacity) {
+    if (capacity <= data_.capacity()) return;
+    if constexpr (Stats::enabled) {
+        stats_.record_reallocation();
+        stats_.record_allocation();
+        if (data_.capacity() > 0) stats_.record_free();
+    }
+    data_.reserve(capacity);
+}
+
+template <typename T, typename Stats>
+void Stack<T, Stats>::shrink_to_fit() {
+    if (data_.size() == data_.capacity()) return;
+    if constexpr (Stats::enabled) {
+        stats_.record_reallocation();
+        if (!data_.empty()) stats_.record_allocation();
+        stats_.record_free();
+    }
+    data_.shrink_to_fit();
+}
+
 // ### Access methods ###
 
-template <typename T>
-const T& Stack<T>::top() const {
-    if (empty()) throw std::out_of_range("top on empty stack");
+template <typename T, typename Stats>
+const T& Stack<T, Stats>::top() const {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::access);
+    if (empty()) {
+        stats_.record_exception(Operation::access);
+        throw std::out_of_range("top on empty stack");
+    }
     return data_.back();
 }
 
-template <typename T>
-T& Stack<T>::top() {
-    if (empty()) throw std::out_of_range("top on empty stack");
+template <typename T, typename Stats>
+T& Stack<T, Stats>::top() {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::access);
+    if (empty()) {
+        stats_.record_exception(Operation::access);
+        throw std::out_of_range("top on empty stack");
+    }
     return data_.back();
 }
 
+template <typename T, typename Stats>
+const T* Stack<T, Stats>::data() const noexcept {
+    return data_.data();
+}
+
 // ### Modifier methods ###
 
-template <typename T>
-void Stack<T>::push(const T& element) {
+template <typename T, typename Stats>
+void Stack<T, Stats>::push(const T& element) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::push);
+    recordGrowth();
     data_.push_back(element);
+    stats_.record_size(data_.size());
 }
 
-template <typename T>
-void Stack<T>::push(T&& element) {
+template <typename T, typename Stats>
+void Stack<T, Stats>::push(T&& element) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::push);
+    recordGrowth();
     data_.push_back(std::move(element));
+    stats_.record_size(data_.size());
 }
 
-template <typename T>
+template <typename T, typename Stats>
 template <class... Args>
-void Stack<T>::emplace(Args&&... args) {
+void Stack<T, Stats>::emplace(Args&&... args) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::push);
+    recordGrowth();
     data_.emplace_back(std::forward<Args>(args)...);
+    stats_.record_size(data_.size());
 }
 
-template <typename T>
-T Stack<T>::pop() {
-    if (empty()) throw std::out_of_range("pop on empty stack");
+template <typename T, typename Stats>
+T Stack<T, Stats>::pop() {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::pop);
+    if (empty()) {
+        stats_.record_exception(Operation::pop);
+        throw std::out_of_range("pop on empty stack");
+    }
 
     T value = std::move(data_.back());
     data_.pop_back();
@@ -56,31 +113,177 @@ T Stack<T>::pop() {
     return value;
 }
 
-template <typename T>
-void Stack<T>::clear() noexcept {
+template <typename T, typename Stats>
+template <std::ranges::input_range R>
+    requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+void Stack<T, Stats>::push_range(R&& range) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::push);
+
+    if constexpr (std::ranges::contiguous_range<R> && std::ranges::sized_range<R>
+                  && std::same_as<std::remove_cv_t<std::ranges::range_value_t<R>>, T>
+                  && std::is_trivially_copyable_v<T>) {
+        std::size_t count = std::ranges::size(range);
+        if (count == 0) return;
+
+        // Read the source before growFor can free it: a span over this
+        // stack's own elements is copied out first.
+        const T* first = std::ranges::data(range);
+        std::less<const T*> before;
+        if (!before(first, data_.data()) && before(first, data_.data() + data_.size())) {
+            std::vector<T> copy(first, first + count);
+            growFor(count);
+            data_.insert(data_.end(), copy.begin(), copy.end());
+        } else {
+            growFor(count);
+            // vector::resize would zero the new tail first; insert from raw
+            // pointers copies once, with memmove.
+            data_.insert(data_.end(), first, first + count);
+        }
+    } else if constexpr (std::ranges::sized_range<R>) {
+        std::size_t count = std::ranges::size(range);
+        if (data_.size() + count <= data_.capacity()) {
+            for (auto&& value : range) data_.emplace_back(std::forward<decltype(value)>(value));
+        } else {
+            // The range may view this stack's own elements, which growFor
+            // is about to move: take the values out first.
+            std::vector<T> staged;
+            staged.reserve(count);
+            for (auto&& value : range) staged.emplace_back(std::forward<decltype(value)>(value));
+            growFor(count);
+            data_.insert(data_.end(), std::make_move_iterator(staged.begin()), std::make_move_iterator(staged.end()));
+        }
+    } else {
+        for (auto&& value : range) {
+            recordGrowth();
+            data_.emplace_back(std::forward<decltype(value)>(value));
+        }
+    }
+    stats_.record_size(data_.size());
+}
+
+template <typename T, typename Stats>
+void Stack<T, Stats>::append(std::span<const T> values) {
+    push_range(values);
+}
+
+template <typename T, typename Stats>
+void Stack<T, Stats>::pop_n(std::size_t count) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::pop);
+    if (count > data_.size()) {
+        stats_.record_exception(Operation::pop);
+        throw std::out_of_range("pop_n past the bottom of the stack");
+    }
+    data_.erase(data_.end() - static_cast<std::ptrdiff_t>(count), data_.end());
+}
+
+template <typename T, typename Stats>
+template <std::output_iterator<T> Out>
+Out Stack<T, Stats>::pop_n(std::size_t count, Out out) {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::pop);
+    if (count > data_.size()) {
+        stats_.record_exception(Operation::pop);
+        throw std::out_of_range("pop_n past the bottom of the stack");
+    }
+
+    auto first = data_.end() - static_cast<std::ptrdiff_t>(count);
+    constexpr bool memcpyable = std::is_trivially_copyable_v<T> && requires {
+        requires std::contiguous_iterator<Out>;
+        requires std::same_as<std::iter_value_t<Out>, T>;
+    };
+    if constexpr (memcpyable) {
+        if (count > 0) std::memcpy(std::to_address(out), std::to_address(first), count * sizeof(T));
+        out += static_cast<std::iter_difference_t<Out>>(count);
+    } else {
+        out = std::move(first, data_.end(), out);
+    }
+    data_.erase(first, data_.end());
+
+    return out;
+}
+
+template <typename T, typename Stats>
+void Stack<T, Stats>::pop_into(std::span<T> out) {
+    pop_n(out.size(), out.begin());
+}
+
+template <typename T, typename Stats>
+void Stack<T, Stats>::clear() noexcept {
+    [[maybe_unused]] auto scope = stats_.scope(Operation::clear);
     data_.clear();
 }
 
 // ### Operators ###
 
-template <typename T>
-bool Stack<T>::operator==(const Stack<T>& other) const {
+template <typename T, typename Stats>
+bool Stack<T, Stats>::operator==(const Stack<T, Stats>& other) const {
     return this->data_ == other.data_;
 }
 
-template <typename T>
-bool Stack<T>::operator!=(const Stack& other) const {
+template <typename T, typename Stats>
+bool Stack<T, Stats>::operator!=(const Stack& other) const {
     return this->data_ != other.data_;
 }
 
 // ### Swap methods ###
 
-template <typename T>
-void Stack<T>::swap(Stack& other) noexcept {
+template <typename T, typename Stats>
+void Stack<T, Stats>::swap(Stack& other) noexcept {
     data_.swap(other.data_);
 }
 
-template <typename T>
-void swap(Stack<T>& a, Stack<T>& b) noexcept {
+// ### Statistics ###
+
+template <typename T, typename Stats>
+ContainerStats Stack<T, Stats>::stats() const noexcept {
+    return stats_.snapshot();
+}
+
+template <typename T, typename Stats>
+void Stack<T, Stats>::reset_stats() noexcept {
+    stats_.reset();
+}
+
+template <typename T, typename Stats>
+void Stack<T, Stats>::recordGrowth() noexcept {
+    if constexpr (Stats::enabled) {
+        if (data_.size() == data_.capacity()) {
+            stats_.record_reallocation();
+            stats_.record_allocation();
+            if (data_.capacity() > 0) stats_.record_free();
+        }
+    }
+}
+
+// Makes room for `count` more elements with one allocation, keeping the
+// geometric growth a run of single pushes would have had.
+template <typename T, typename Stats>
+void Stack<T, Stats>::growFor(std::size_t count) {
+    std::size_t needed = data_.size() + count;
+    if (needed <= data_.capacity()) return;
+    reserve(std::max(needed, 2 * data_.capacity()));
+}
+
+// ### Snapshot methods ###
+
+template <typename T, typename Stats>
+void Stack<T, Stats>::save(const std::string& path) const requires std::is_trivially_copyable_v<T> {
+    SnapshotWriter<T> writer(path, data_.size());
+    writer.write(data_.data(), data_.size());
+    writer.close();
+}
+
+template <typename T, typename Stats>
+Stack<T, Stats> Stack<T, Stats>::load(const std::string& path) requires std::is_trivially_copyable_v<T> {
+    SnapshotReader<T> reader(path);
+
+    Stack stack;
+    stack.data_.resize(reader.count());
+    reader.read(stack.data_.data(), stack.data_.size());
+
+    return stack;
+}
+
+template <typename T, typename Stats>
+void swap(Stack<T, Stats>& a, Stack<T, Stats>& b) noexcept {
     a.swap(b);
 }
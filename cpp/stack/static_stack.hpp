@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+// Smallest unsigned integer type able to count up to N.
+template <std::size_t N>
+using smallest_size_t =
+    std::conditional_t<N <= std::numeric_limits<std::uint8_t>::max(), std::uint8_t,
+    std::conditional_t<N <= std::numeric_limits<std::uint16_t>::max(), std::uint16_t,
+    std::conditional_t<N <= std::numeric_limits<std::uint32_t>::max(), std::uint32_t, std::uint64_t>>>;
+
+// Fixed-capacity stack with inline storage: never allocates and, for trivial
+// T, is usable in constant expressions. Only the slots below size() hold
+// objects, so T needs no default constructor. For trivially copyable T the
+// stack is trivially copyable too.
+template <typename T, std::size_t N>
+class StaticStack {
+    static_assert(N > 0, "StaticStack needs a non-zero capacity");
+public:
+    using size_type = smallest_size_t<N>;
+private:
+    // Trivial T sits in a plain array: default-initializing it runs no code,
+    // and constant evaluation accepts construct_at on its slots. Any other T
+    // goes in a union member, which stays unconstructed until pushed; building
+    // those slots at compile time needs a compiler that allows construct_at
+    // into an inactive union member (GCC does, Clang does not).
+    struct TrivialStorage {
+        T items[N];
+    };
+
+    union Storage {
+        T items[N];
+
+        constexpr Storage() noexcept {}
+        constexpr ~Storage() requires std::is_trivially_destructible_v<T> = default;
+        constexpr ~Storage() {}
+    };
+
+    static constexpr bool trivialStorage = std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>;
+
+    std::conditional_t<trivialStorage, TrivialStorage, Storage> storage_;
+    size_type size_ = 0;
+
+    constexpr void release(size_type pos) noexcept;
+public:
+    constexpr StaticStack() noexcept;
+    constexpr StaticStack(const StaticStack& other) requires std::is_trivially_copyable_v<T> = default;
+    constexpr StaticStack(const StaticStack& other);
+    constexpr StaticStack(StaticStack&& other) noexcept requires std::is_trivially_copyable_v<T> = default;
+    constexpr StaticStack(StaticStack&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    constexpr ~StaticStack() requires std::is_trivially_destructible_v<T> = default;
+    constexpr ~StaticStack();
+
+    constexpr StaticStack& operator=(const StaticStack& other) requires std::is_trivially_copyable_v<T> = default;
+    constexpr StaticStack& operator=(const StaticStack& other);
+    constexpr StaticStack& operator=(StaticStack&& other) noexcept requires std::is_trivially_copyable_v<T> = default;
+    constexpr StaticStack& operator=(StaticStack&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    constexpr std::size_t size() const noexcept;
+    constexpr bool empty() const noexcept;
+    constexpr bool full() const noexcept;
+    static constexpr std::size_t capacity() noexcept;
+
+    constexpr const T& top() const;
+    constexpr T& top();
+
+    constexpr void push(const T& element);
+    constexpr void push(T&& element);
+
+    constexpr bool try_push(const T& element);
+    constexpr bool try_push(T&& element);
+
+    template <class... Args>
+    constexpr void emplace(Args&&... args);
+
+    constexpr T pop();
+    constexpr void clear() noexcept;
+
+    constexpr bool operator==(const StaticStack& other) const;
+    constexpr bool operator!=(const StaticStack& other) const;
+
+    constexpr void swap(StaticStack& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>);
+};
+
+template <typename T, std::size_t N>
+constexpr void swap(StaticStack<T, N>& a, StaticStack<T, N>& b) noexcept(noexcept(a.swap(b)));
+
+#include "static_stack.inl"
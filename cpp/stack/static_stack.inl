@@ -0,0 +1,183 @@
+#include "static_stack.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+// ### Constructors ###
+
+template <typename T, std::size_t N>
+constexpr StaticStack<T, N>::StaticStack() noexcept {
+    // A compile-time copy reads every slot, so the unused ones need a value
+    if constexpr (trivialStorage) {
+        if (std::is_constant_evaluated()) storage_ = TrivialStorage{};
+    }
+}
+
+template <typename T, std::size_t N>
+constexpr StaticStack<T, N>::StaticStack(const StaticStack& other) {
+    for (; size_ < other.size_; size_++) std::construct_at(storage_.items + size_, other.storage_.items[size_]);
+}
+
+// The moved-from stack keeps its size; its elements are left moved from,
+// as with std::array.
+template <typename T, std::size_t N>
+constexpr StaticStack<T, N>::StaticStack(StaticStack&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    for (; size_ < other.size_; size_++) std::construct_at(storage_.items + size_, std::move(other.storage_.items[size_]));
+}
+
+// ### Destructor ###
+
+template <typename T, std::size_t N>
+constexpr StaticStack<T, N>::~StaticStack() {
+    clear();
+}
+
+// ### Capacity methods ###
+
+template <typename T, std::size_t N>
+constexpr std::size_t StaticStack<T, N>::size() const noexcept {
+    return size_;
+}
+
+template <typename T, std::size_t N>
+constexpr bool StaticStack<T, N>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template <typename T, std::size_t N>
+constexpr bool StaticStack<T, N>::full() const noexcept {
+    return size_ == N;
+}
+
+template <typename T, std::size_t N>
+constexpr std::size_t StaticStack<T, N>::capacity() noexcept {
+    return N;
+}
+
+// ### Access methods ###
+
+template <typename T, std::size_t N>
+constexpr const T& StaticStack<T, N>::top() const {
+    if (empty()) throw std::out_of_range("top on empty stack");
+    return storage_.items[size_ - 1];
+}
+
+template <typename T, std::size_t N>
+constexpr T& StaticStack<T, N>::top() {
+    if (empty()) throw std::out_of_range("top on empty stack");
+    return storage_.items[size_ - 1];
+}
+
+// ### Modifier methods ###
+
+template <typename T, std::size_t N>
+constexpr void StaticStack<T, N>::push(const T& element) {
+    if (!try_push(element)) throw std::length_error("push on full stack");
+}
+
+template <typename T, std::size_t N>
+constexpr void StaticStack<T, N>::push(T&& element) {
+    if (!try_push(std::move(element))) throw std::length_error("push on full stack");
+}
+
+template <typename T, std::size_t N>
+constexpr bool StaticStack<T, N>::try_push(const T& element) {
+    if (full()) return false;
+    std::construct_at(storage_.items + size_, element);
+    size_++;
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr bool StaticStack<T, N>::try_push(T&& element) {
+    if (full()) return false;
+    std::construct_at(storage_.items + size_, std::move(element));
+    size_++;
+    return true;
+}
+
+template <typename T, std::size_t N>
+template <class... Args>
+constexpr void StaticStack<T, N>::emplace(Args&&... args) {
+    if (full()) throw std::length_error("emplace on full stack");
+    std::construct_at(storage_.items + size_, std::forward<Args>(args)...);
+    size_++;
+}
+
+template <typename T, std::size_t N>
+constexpr T StaticStack<T, N>::pop() {
+    if (empty()) throw std::out_of_range("pop on empty stack");
+
+    T value = std::move(storage_.items[size_ - 1]);
+    release(--size_);
+
+    return value;
+}
+
+template <typename T, std::size_t N>
+constexpr void StaticStack<T, N>::clear() noexcept {
+    while (size_ > 0) release(--size_);
+}
+
+template <typename T, std::size_t N>
+constexpr void StaticStack<T, N>::release(size_type pos) noexcept {
+    std::destroy_at(storage_.items + pos);
+}
+
+// ### Operators ###
+
+template <typename T, std::size_t N>
+constexpr StaticStack<T, N>& StaticStack<T, N>::operator=(const StaticStack& other) {
+    if (this != &other) {
+        clear();
+        for (; size_ < other.size_; size_++) std::construct_at(storage_.items + size_, other.storage_.items[size_]);
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N>
+constexpr StaticStack<T, N>& StaticStack<T, N>::operator=(StaticStack&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+    if (this != &other) {
+        clear();
+        for (; size_ < other.size_; size_++) std::construct_at(storage_.items + size_, std::move(other.storage_.items[size_]));
+    }
+    return *this;
+}
+
+template <typename T, std::size_t N>
+constexpr bool StaticStack<T, N>::operator==(const StaticStack& other) const {
+    if (size_ != other.size_) return false;
+    for (size_type i = 0; i < size_; i++) {
+        if (!(storage_.items[i] == other.storage_.items[i])) return false;
+    }
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr bool StaticStack<T, N>::operator!=(const StaticStack& other) const {
+    return !(*this == other);
+}
+
+// ### Swap methods ###
+
+template <typename T, std::size_t N>
+constexpr void StaticStack<T, N>::swap(StaticStack& other) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_swappable_v<T>) {
+    StaticStack& longer = size_ > other.size_ ? *this : other;
+    StaticStack& shorter = size_ > other.size_ ? other : *this;
+
+    size_type common = shorter.size_;
+    using std::swap;
+    for (size_type i = 0; i < common; i++) swap(storage_.items[i], other.storage_.items[i]);
+    // The rest moves across into slots that hold no object yet
+    for (size_type i = common; i < longer.size_; i++) {
+        std::construct_at(shorter.storage_.items + i, std::move(longer.storage_.items[i]));
+        std::destroy_at(longer.storage_.items + i);
+    }
+    std::swap(size_, other.size_);
+}
+
+template <typename T, std::size_t N>
+constexpr void swap(StaticStack<T, N>& a, StaticStack<T, N>& b) noexcept(noexcept(a.swap(b))) {
+    a.swap(b);
+}
@@ -0,0 +1,145 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../cow_stack.hpp"
+
+TEST_CASE("push, top and pop across chunks", "[modifiers]") {
+    CowStack<int> stack;
+    int n = static_cast<int>(CowStack<int>::chunkCapacity * 3 + 5);
+
+    for (int i = 0; i < n; i++) stack.push(i);
+    REQUIRE(stack.size() == static_cast<std::size_t>(n));
+    REQUIRE(stack.top() == n - 1);
+
+    for (int i = n - 1; i >= 0; i--) REQUIRE(stack.pop() == i);
+    REQUIRE(stack.empty());
+}
+
+TEST_CASE("snapshot does not see later changes", "[snapshot]") {
+    CowStack<int> stack;
+    for (int i = 0; i < 100; i++) stack.push(i);
+
+    auto before = stack.snapshot();
+    stack.top() = -1;
+    for (int i = 0; i < 50; i++) stack.pop();
+    stack.push(1000);
+
+    REQUIRE(before.size() == 100);
+    REQUIRE(before.top() == 99);
+    std::vector<int> expected(100);
+    std::iota(expected.begin(), expected.end(), 0);
+    REQUIRE(before.to_vector() == expected);
+
+    auto after = stack.snapshot();
+    REQUIRE(after.size() == 51);
+    REQUIRE(after.top() == 1000);
+    REQUIRE(*std::next(after.begin()) == 49);
+}
+
+TEST_CASE("snapshots survive popping below a chunk boundary", "[snapshot]") {
+    std::size_t capacity = CowStack<int>::chunkCapacity;
+    CowStack<int> stack;
+    for (std::size_t i = 0; i < capacity * 2; i++) stack.push(static_cast<int>(i));
+
+    auto full = stack.snapshot();
+    for (std::size_t i = 0; i < capacity + 3; i++) stack.pop();
+    // Writes into the lower chunk, which the snapshot still shares
+    for (std::size_t i = 0; i < 10; i++) stack.push(-1);
+
+    std::vector<int> expected(capacity * 2);
+    std::iota(expected.begin(), expected.end(), 0);
+    REQUIRE(full.to_vector() == expected);
+
+    std::vector<int> mine = stack.snapshot().to_vector();
+    REQUIRE(mine.size() == capacity - 3 + 10);
+    REQUIRE(mine[capacity - 4] == static_cast<int>(capacity - 4));
+    REQUIRE(mine.back() == -1);
+}
+
+TEST_CASE("copies share storage until written", "[copy]") {
+    CowStack<std::string> a;
+    a.push("x");
+    a.push("y");
+
+    CowStack<std::string> b = a;
+    b.push("z");
+    a.pop();
+
+    REQUIRE(a.size() == 1);
+    REQUIRE(a.top() == "x");
+    REQUIRE(b.size() == 3);
+    REQUIRE(b.pop() == "z");
+    REQUIRE(b.pop() == "y");
+}
+
+TEST_CASE("non-trivial elements are released once", "[templates]") {
+    auto tracker = std::make_shared<int>(0);
+    {
+        CowStack<std::shared_ptr<int>> stack;
+        for (int i = 0; i < 200; i++) stack.push(tracker);
+        auto snap = stack.snapshot();
+        for (int i = 0; i < 150; i++) stack.pop();
+        stack.emplace(tracker);
+        REQUIRE(tracker.use_count() > 1);
+    }
+    REQUIRE(tracker.use_count() == 1);
+}
+
+TEST_CASE("snapshots can be read on other threads while the owner mutates", "[snapshot][threads]") {
+    CowStack<std::size_t> stack;
+    std::atomic<bool> done = false;
+    std::atomic<std::size_t> checked = 0;
+    std::atomic<std::size_t> mismatches = 0;
+
+    std::vector<CowStack<std::size_t>::Snapshot> handoff;
+    std::mutex handoffMutex;
+
+    std::thread reader([&] {
+        while (!done.load()) {
+            CowStack<std::size_t>::Snapshot snap;
+            {
+                std::lock_guard lock(handoffMutex);
+                if (handoff.empty()) continue;
+                snap = std::move(handoff.back());
+                handoff.pop_back();
+            }
+            // The owner only ever pushes the current depth
+            std::size_t expected = snap.size();
+            for (std::size_t value : snap) {
+                if (value != --expected) mismatches++;
+            }
+            checked++;
+        }
+    });
+
+    for (std::size_t round = 0; round < 20'000; round++) {
+        if (round % 3 == 2 && !stack.empty()) {
+            stack.pop();
+        } else {
+            stack.push(stack.size());
+        }
+        if (round % 97 == 0) {
+            std::lock_guard lock(handoffMutex);
+            handoff.push_back(stack.snapshot());
+        }
+    }
+    while (checked.load() == 0) std::this_thread::yield();
+    done = true;
+    reader.join();
+
+    REQUIRE(mismatches == 0);
+}
+
+TEST_CASE("errors", "[exceptions]") {
+    CowStack<int> stack;
+    REQUIRE_THROWS_AS(stack.pop(), std::out_of_range);
+    REQUIRE_THROWS_AS(stack.top(), std::out_of_range);
+    REQUIRE_THROWS_AS(stack.snapshot().top(), std::out_of_range);
+}
@@ -0,0 +1,150 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../soa_stack.hpp"
+
+using Records = SoaStack<double, std::uint32_t, std::uint8_t>;
+
+TEST_CASE("push, top and pop", "[modifiers]") {
+    Records stack;
+
+    stack.push(1.5, 7u, std::uint8_t(1));
+    stack.push({2.5, 8u, std::uint8_t(2)});
+    REQUIRE(stack.size() == 2);
+
+    auto [value, tag, flags] = stack.top();
+    REQUIRE(value == 2.5);
+    REQUIRE(tag == 8u);
+    REQUIRE(flags == 2);
+
+    REQUIRE(stack.pop() == Records::value_type{2.5, 8u, std::uint8_t(2)});
+    REQUIRE(stack.pop() == Records::value_type{1.5, 7u, std::uint8_t(1)});
+    REQUIRE(stack.empty());
+}
+
+TEST_CASE("top is a proxy that writes through to the columns", "[access]") {
+    Records stack;
+    stack.push(1.0, 1u, std::uint8_t(0));
+    stack.push(2.0, 2u, std::uint8_t(0));
+
+    std::get<0>(stack.top()) = 20.0;
+    stack.top() = Records::value_type{30.0, 3u, std::uint8_t(9)};
+
+    REQUIRE(stack.column<0>()[1] == 30.0);
+    REQUIRE(stack.column<1>()[1] == 3u);
+    REQUIRE(stack.column<2>()[1] == 9);
+    REQUIRE(stack.column<0>()[0] == 1.0);
+
+    const Records& view = stack;
+    REQUIRE(std::get<1>(view.top()) == 3u);
+}
+
+TEST_CASE("columns are contiguous and ordered bottom first", "[access]") {
+    Records stack;
+    for (std::uint32_t i = 0; i < 100; ++i) stack.push(i * 0.5, i, std::uint8_t(i % 3));
+
+    auto values = stack.column<0>();
+    REQUIRE(values.size() == 100);
+    REQUIRE(std::accumulate(values.begin(), values.end(), 0.0) == 0.5 * 99 * 100 / 2);
+
+    for (double& v : stack.column<0>()) v *= 2;
+    REQUIRE(std::get<0>(stack.top()) == 99.0);
+}
+
+TEST_CASE("bulk push and pop", "[modifiers]") {
+    Records stack;
+    stack.push(-1.0, 0u, std::uint8_t(0));
+
+    std::vector<double> values{1.0, 2.0, 3.0, 4.0};
+    std::vector<std::uint32_t> tags{1, 2, 3, 4};
+    std::vector<std::uint8_t> flags{1, 0, 1, 0};
+    stack.push_range(values, tags, flags);
+    REQUIRE(stack.size() == 5);
+    REQUIRE(std::get<1>(stack.top()) == 4u);
+
+    std::vector<double> outValues(3);
+    std::vector<std::uint32_t> outTags(3);
+    std::vector<std::uint8_t> outFlags(3);
+    stack.pop_into(outValues, outTags, outFlags);
+    REQUIRE(outValues == std::vector<double>{2.0, 3.0, 4.0});
+    REQUIRE(outTags == std::vector<std::uint32_t>{2, 3, 4});
+    REQUIRE(stack.size() == 2);
+    REQUIRE(std::get<0>(stack.top()) == 1.0);
+
+    stack.pop_n(2);
+    REQUIRE(stack.empty());
+    REQUIRE(stack.column<2>().empty());
+}
+
+TEST_CASE("repeated bulk pushes grow the columns geometrically", "[modifiers][capacity]") {
+    Records stack;
+    double value = 1.0;
+    std::uint32_t tag = 2;
+    std::uint8_t flag = 3;
+
+    std::size_t moves = 0;
+    const double* data = nullptr;
+    for (int i = 0; i < 1000; i++) {
+        stack.push_range(std::span(&value, 1), std::span(&tag, 1), std::span(&flag, 1));
+        if (stack.column<0>().data() != data) moves++;
+        data = stack.column<0>().data();
+    }
+    REQUIRE(stack.size() == 1000);
+    REQUIRE(moves < 30);
+}
+
+TEST_CASE("push_range from the stack's own columns", "[modifiers]") {
+    SoaStack<std::string, int> stack;
+    stack.push("a", 1);
+    stack.push("b", 2);
+
+    stack.push_range(stack.column<0>(), stack.column<1>());
+    REQUIRE(stack.size() == 4);
+
+    std::vector<std::string> names(4);
+    std::vector<int> ids(4);
+    stack.pop_into(names, ids);
+    REQUIRE(names == std::vector<std::string>{"a", "b", "a", "b"});
+    REQUIRE(ids == std::vector<int>{1, 2, 1, 2});
+}
+
+TEST_CASE("bulk operations validate their arguments", "[exceptions]") {
+    Records stack;
+    std::vector<double> values{1.0, 2.0};
+    std::vector<std::uint32_t> tags{1};
+    std::vector<std::uint8_t> flags{1, 2};
+
+    REQUIRE_THROWS_AS(stack.push_range(values, tags, flags), std::invalid_argument);
+    REQUIRE(stack.empty());
+
+    REQUIRE_THROWS_AS(stack.pop(), std::out_of_range);
+    REQUIRE_THROWS_AS(stack.top(), std::out_of_range);
+    REQUIRE_THROWS_AS(stack.pop_n(1), std::out_of_range);
+
+    std::vector<std::uint32_t> outTags(2);
+    REQUIRE_THROWS_AS(stack.pop_into(values, outTags, flags), std::out_of_range);
+}
+
+TEST_CASE("works with non-trivial fields", "[templates]") {
+    SoaStack<std::string, int> stack;
+    stack.push("hello", 1);
+    stack.push(std::string(40, 'x'), 2);
+
+    SoaStack<std::string, int> copy(stack);
+    REQUIRE(copy == stack);
+
+    auto [text, number] = stack.pop();
+    REQUIRE(text == std::string(40, 'x'));
+    REQUIRE(number == 2);
+    REQUIRE(copy != stack);
+
+    swap(copy, stack);
+    REQUIRE(stack.size() == 2);
+    REQUIRE(copy.size() == 1);
+    REQUIRE(std::get<0>(copy.top()) == "hello");
+}
@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+#include <csignal>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include "../spilling_stack.hpp"
+
+TEST_CASE("push and pop past the memory window", "[modifiers]") {
+    SpillingStack<std::uint64_t> stack(4, 2);
+
+    for (std::uint64_t i = 0; i < 1000; i++) stack.push(i);
+    REQUIRE(stack.size() == 1000);
+    REQUIRE(stack.top() == 999);
+    REQUIRE(stack.resident_segments() <= stack.window());
+
+    for (std::uint64_t i = 1000; i-- > 0;) REQUIRE(stack.pop() == i);
+    REQUIRE(stack.empty());
+    REQUIRE(stack.spilled_bytes() > 0);
+}
+
+TEST_CASE("interleaved pushes and pops match a vector", "[modifiers]") {
+    SpillingStack<std::uint32_t> stack(8, 1);
+    std::vector<std::uint32_t> expected;
+    std::mt19937 rng(7);
+
+    for (int step = 0; step < 50'000; step++) {
+        // Drift upward, then back down, to cross spilled segments both ways
+        bool push = expected.empty() || rng() % 100 < (step < 25'000 ? 60u : 40u);
+        if (push) {
+            std::uint32_t value = rng();
+            stack.push(value);
+            expected.push_back(value);
+        } else {
+            REQUIRE(stack.pop() == expected.back());
+            expected.pop_back();
+        }
+        REQUIRE(stack.size() == expected.size());
+    }
+
+    while (!expected.empty()) {
+        REQUIRE(stack.pop() == expected.back());
+        expected.pop_back();
+    }
+}
+
+TEST_CASE("writes through top survive a spill", "[access]") {
+    SpillingStack<int> stack(2, 1);
+
+    for (int i = 0; i < 10; i++) stack.push(i);
+    for (int i = 0; i < 5; i++) stack.pop();
+    stack.top() = 40;
+
+    for (int i = 0; i < 20; i++) stack.push(100 + i);
+    for (int i = 0; i < 20; i++) stack.pop();
+
+    REQUIRE(stack.pop() == 40);
+    REQUIRE(stack.pop() == 3);
+}
+
+TEST_CASE("records spill with their layout intact", "[modifiers]") {
+    struct Record {
+        double value;
+        std::uint16_t tag;
+    };
+    SpillingStack<Record> stack(3, 2);
+
+    for (int i = 0; i < 100; i++) stack.push({i * 0.5, static_cast<std::uint16_t>(i)});
+    for (int i = 99; i >= 0; i--) {
+        Record record = stack.pop();
+        REQUIRE(record.value == i * 0.5);
+        REQUIRE(record.tag == i);
+    }
+}
+
+TEST_CASE("clear empties the stack and it stays usable", "[modifiers]") {
+    SpillingStack<int> stack(4, 2);
+
+    for (int i = 0; i < 100; i++) stack.push(i);
+    stack.clear();
+    REQUIRE(stack.empty());
+    REQUIRE(stack.resident_segments() == 0);
+
+    for (int i = 0; i < 50; i++) stack.push(-i);
+    for (int i = 49; i >= 0; i--) REQUIRE(stack.pop() == -i);
+}
+
+TEST_CASE("errors", "[exceptions]") {
+    SpillingStack<int> stack(4, 2);
+    REQUIRE_THROWS_AS(stack.pop(), std::out_of_range);
+    REQUIRE_THROWS_AS(stack.top(), std::out_of_range);
+
+    REQUIRE_THROWS_AS(SpillingStack<int>(0, 2), std::invalid_argument);
+    REQUIRE_THROWS_AS(SpillingStack<int>(4, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(SpillingStack<int>(4, 2, "/nonexistent/spill/dir"), std::runtime_error);
+}
+
+TEST_CASE("a failed spill leaves a pop with nothing lost", "[exceptions]") {
+    // Any write to the spill file now fails with EFBIG instead of a signal
+    struct rlimit saved;
+    ::getrlimit(RLIMIT_FSIZE, &saved);
+    struct rlimit none = saved;
+    none.rlim_cur = 0;
+    ::setrlimit(RLIMIT_FSIZE, &none);
+    auto previous = std::signal(SIGXFSZ, SIG_IGN);
+
+    {
+        SpillingStack<int> stack(4, 1);
+        for (int i = 0; i < 8; i++) stack.push(i);
+
+        for (int i = 7; i > 4; i--) REQUIRE(stack.pop() == i);
+        REQUIRE_THROWS_AS(stack.pop(), std::runtime_error);
+        REQUIRE(stack.size() == 5);
+        REQUIRE(stack.top() == 4);
+
+        stack.push(40);
+        REQUIRE(stack.pop() == 40);
+        REQUIRE(stack.top() == 4);
+    }
+
+    std::signal(SIGXFSZ, previous);
+    ::setrlimit(RLIMIT_FSIZE, &saved);
+}
@@ -0,0 +1,175 @@
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../static_stack.hpp"
+
+// Evaluated entirely at compile time: reverse a sequence through the stack.
+constexpr std::array<int, 5> reversed(std::array<int, 5> input) {
+    StaticStack<int, 5> stack;
+    for (int value : input) stack.push(value);
+
+    std::array<int, 5> output{};
+    for (int& value : output) value = stack.pop();
+    return output;
+}
+
+// Precomputes the nesting depth of every prefix of a bracket string.
+template <std::size_t Length>
+constexpr std::array<int, Length> nestingDepths(const char (&text)[Length]) {
+    StaticStack<char, Length> open;
+    std::array<int, Length> depths{};
+    for (std::size_t i = 0; i + 1 < Length; ++i) {
+        if (text[i] == '(') open.push(text[i]);
+        else if (text[i] == ')') open.pop();
+        depths[i] = static_cast<int>(open.size());
+    }
+    return depths;
+}
+
+constexpr bool overflowRejected() {
+    StaticStack<int, 2> stack;
+    return stack.try_push(1) && stack.try_push(2) && !stack.try_push(3) && stack.full() && stack.top() == 2;
+}
+
+constexpr bool swapAndCompare() {
+    StaticStack<int, 4> a;
+    StaticStack<int, 4> b;
+    a.push(1);
+    a.push(2);
+    a.push(3);
+    b.emplace(9);
+
+    swap(a, b);
+    if (a.size() != 1 || a.top() != 9 || b.size() != 3 || b.top() != 3) return false;
+
+    StaticStack<int, 4> c = b;
+    if (c != b) return false;
+    c.pop();
+    return c != b && !(c == b);
+}
+
+static_assert(reversed({1, 2, 3, 4, 5}) == std::array<int, 5>{5, 4, 3, 2, 1});
+static_assert(nestingDepths("(()())")[1] == 2);
+static_assert(nestingDepths("(()())")[5] == 0);
+static_assert(overflowRejected());
+static_assert(swapAndCompare());
+static_assert(std::is_trivially_copyable_v<StaticStack<int, 4>>);
+
+// Swapping moves elements, so it is only noexcept when moving T is
+struct ThrowingMove {
+    ThrowingMove() = default;
+    ThrowingMove(ThrowingMove&&) {}
+    ThrowingMove& operator=(ThrowingMove&&) { return *this; }
+};
+
+static_assert(std::is_nothrow_swappable_v<StaticStack<std::string, 4>>);
+static_assert(!std::is_nothrow_swappable_v<StaticStack<ThrowingMove, 4>>);
+
+TEST_CASE("size type is the smallest that fits", "[capacity]") {
+    STATIC_REQUIRE(std::is_same_v<StaticStack<int, 255>::size_type, std::uint8_t>);
+    STATIC_REQUIRE(std::is_same_v<StaticStack<int, 256>::size_type, std::uint16_t>);
+    STATIC_REQUIRE(std::is_same_v<StaticStack<char, 70000>::size_type, std::uint32_t>);
+    STATIC_REQUIRE(sizeof(StaticStack<std::uint8_t, 15>) == 16);
+    STATIC_REQUIRE(StaticStack<int, 8>::capacity() == 8);
+}
+
+TEST_CASE("compile-time evaluation", "[constexpr]") {
+    STATIC_REQUIRE(reversed({1, 2, 3, 4, 5})[0] == 5);
+    STATIC_REQUIRE(overflowRejected());
+    STATIC_REQUIRE(swapAndCompare());
+}
+
+TEST_CASE("push, top and pop", "[modifiers]") {
+    StaticStack<int, 3> stack;
+
+    stack.push(1);
+    stack.push(2);
+    REQUIRE(stack.size() == 2);
+    REQUIRE(stack.top() == 2);
+
+    REQUIRE(stack.pop() == 2);
+    REQUIRE(stack.pop() == 1);
+    REQUIRE(stack.empty());
+}
+
+TEST_CASE("overflow and underflow", "[exceptions]") {
+    StaticStack<int, 1> stack;
+    stack.push(1);
+
+    REQUIRE_FALSE(stack.try_push(2));
+    REQUIRE_THROWS_AS(stack.push(2), std::length_error);
+    REQUIRE_THROWS_AS(stack.emplace(2), std::length_error);
+
+    stack.clear();
+    REQUIRE_THROWS_AS(stack.pop(), std::out_of_range);
+    REQUIRE_THROWS_AS(stack.top(), std::out_of_range);
+}
+
+TEST_CASE("works with non-trivial types", "[templates]") {
+    StaticStack<std::string, 4> stack;
+
+    stack.push("hello");
+    std::string world = "world";
+    stack.push(std::move(world));
+    stack.emplace(3, 'x');
+
+    REQUIRE(stack.top() == "xxx");
+    REQUIRE(stack.pop() == "xxx");
+    REQUIRE(stack.pop() == "world");
+    REQUIRE(stack.top() == "hello");
+
+    StaticStack<std::string, 4> copy(stack);
+    REQUIRE(copy == stack);
+}
+
+namespace {
+
+// Counts live objects and rejects default construction and copies
+struct Tracked {
+    static inline int live = 0;
+    int value;
+
+    explicit Tracked(int v) : value(v) { live++; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { live++; }
+    Tracked(const Tracked&) = delete;
+    Tracked& operator=(const Tracked&) = delete;
+    Tracked& operator=(Tracked&& other) noexcept = default;
+    ~Tracked() { live--; }
+};
+
+}
+
+TEST_CASE("only pushed slots hold objects", "[templates]") {
+    {
+        StaticStack<Tracked, 8> stack;
+        REQUIRE(Tracked::live == 0);
+
+        stack.emplace(1);
+        stack.emplace(2);
+        stack.emplace(3);
+        REQUIRE(Tracked::live == 3);
+
+        REQUIRE(stack.pop().value == 3);
+        REQUIRE(Tracked::live == 2);
+
+        StaticStack<Tracked, 8> other;
+        other.emplace(9);
+        swap(stack, other);
+        REQUIRE(stack.size() == 1);
+        REQUIRE(stack.top().value == 9);
+        REQUIRE(other.top().value == 2);
+        REQUIRE(Tracked::live == 3);
+
+        StaticStack<Tracked, 8> moved(std::move(other));
+        REQUIRE(moved.size() == 2);
+        REQUIRE(moved.top().value == 2);
+        other.clear();
+        REQUIRE(Tracked::live == 3);
+    }
+    REQUIRE(Tracked::live == 0);
+}
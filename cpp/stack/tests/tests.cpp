@@ -1,7 +1,12 @@
 #include <catch2/catch_test_macros.hpp>
+#include <iterator>
+#include <list>
+#include <ranges>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "../stack.hpp"
 
@@ -194,3 +199,98 @@ TEST_CASE("works with non-trivial types", "[templates]") {
     REQUIRE(stack.top() == "hello");
 }
 
+
+TEST_CASE("push_range keeps the first element deepest", "[modifiers][bulk]") {
+    Stack<int> stack;
+    stack.push(0);
+
+    std::vector<int> values{1, 2, 3};
+    stack.push_range(values);
+    stack.push_range(std::list<int>{4, 5});
+    stack.append(std::vector<int>{6});
+
+    REQUIRE(stack.size() == 7);
+    for (int expected = 6; expected >= 0; expected--) REQUIRE(stack.pop() == expected);
+}
+
+TEST_CASE("push_range grows capacity once", "[capacity][bulk]") {
+    Stack<int> stack;
+    std::vector<int> values(1000, 7);
+
+    stack.push_range(values);
+    REQUIRE(stack.capacity() >= 1000);
+    std::size_t capacity = stack.capacity();
+
+    stack.pop_n(500);
+    stack.push_range(std::span<const int>(values.data(), 500));
+    REQUIRE(stack.capacity() == capacity);
+}
+
+TEST_CASE("push_range from the stack's own elements", "[modifiers][bulk]") {
+    Stack<int> stack;
+    stack.append(std::vector<int>{1, 2, 3});
+    stack.shrink_to_fit();
+
+    stack.append(std::span<const int>(stack.data(), stack.size()));
+    REQUIRE(stack.size() == 6);
+
+    stack.shrink_to_fit();
+    std::span<const int> own(stack.data(), 2);
+    stack.push_range(own | std::views::transform([](int value) { return value * 10; }));
+    REQUIRE(stack.size() == 8);
+
+    for (int expected : {20, 10, 3, 2, 1, 3, 2, 1}) REQUIRE(stack.pop() == expected);
+}
+
+TEST_CASE("pop_n writes the popped elements deepest first", "[modifiers][bulk]") {
+    Stack<int> stack;
+    stack.append(std::vector<int>{1, 2, 3, 4, 5});
+
+    std::vector<int> out;
+    stack.pop_n(3, std::back_inserter(out));
+    REQUIRE(out == std::vector<int>{3, 4, 5});
+    REQUIRE(stack.top() == 2);
+
+    int raw[2];
+    int* end = stack.pop_n(2, raw);
+    REQUIRE(end == raw + 2);
+    REQUIRE(raw[0] == 1);
+    REQUIRE(raw[1] == 2);
+    REQUIRE(stack.empty());
+}
+
+TEST_CASE("pop_into fills a span and pop_n discards", "[modifiers][bulk]") {
+    Stack<std::string> stack;
+    stack.push_range(std::vector<std::string>{"a", "b", "c", "d"});
+
+    std::vector<std::string> out(2);
+    stack.pop_into(out);
+    REQUIRE(out == std::vector<std::string>{"c", "d"});
+
+    stack.pop_n(1);
+    REQUIRE(stack.size() == 1);
+    REQUIRE(stack.top() == "a");
+}
+
+TEST_CASE("bulk pops past the bottom throw and leave the stack intact", "[modifiers][bulk][exceptions]") {
+    Stack<int> stack;
+    stack.append(std::vector<int>{1, 2});
+
+    std::vector<int> out(3);
+    REQUIRE_THROWS_AS(stack.pop_into(out), std::out_of_range);
+    REQUIRE_THROWS_AS(stack.pop_n(3), std::out_of_range);
+    REQUIRE(stack.size() == 2);
+}
+
+TEST_CASE("reserve and shrink_to_fit", "[capacity]") {
+    Stack<int> stack;
+
+    stack.reserve(100);
+    REQUIRE(stack.capacity() >= 100);
+    REQUIRE(stack.empty());
+
+    stack.push(1);
+    stack.shrink_to_fit();
+    REQUIRE(stack.capacity() == 1);
+    REQUIRE(stack.top() == 1);
+}
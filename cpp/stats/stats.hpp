@@ -0,0 +1,103 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// Container operations that instrumentation policies count separately.
+enum class Operation : std::uint8_t {
+    push,
+    pop,
+    access,
+    at,
+    find,
+    insert,
+    erase,
+    sort,
+    compact,
+    clear,
+};
+
+inline constexpr std::size_t operationCount = static_cast<std::size_t>(Operation::clear) + 1;
+
+// Bucket i counts calls that took [2^i, 2^(i+1)) nanoseconds.
+inline constexpr std::size_t latencyBuckets = 32;
+
+struct OperationStats {
+    std::uint64_t calls = 0;
+    std::uint64_t nodesVisited = 0;
+    std::uint64_t exceptions = 0;
+    std::array<std::uint64_t, latencyBuckets> latency{};
+};
+
+struct ContainerStats {
+    std::uint64_t allocations = 0;
+    std::uint64_t frees = 0;
+    std::uint64_t reallocations = 0;
+    std::uint64_t peakSize = 0;
+    std::array<OperationStats, operationCount> operations{};
+
+    const OperationStats& operator[](Operation op) const noexcept;
+};
+
+// Default policy: every hook is empty and Scope carries no state, so an
+// uninstrumented container compiles to the same code as before.
+struct NoStats {
+    static constexpr bool enabled = false;
+
+    struct Scope {};
+
+    Scope scope(Operation) const noexcept { return {}; }
+
+    void record_allocation(std::size_t = 1) noexcept {}
+    void record_free(std::size_t = 1) noexcept {}
+    void record_reallocation() noexcept {}
+    void record_visits(Operation, std::size_t) noexcept {}
+    void record_exception(Operation) noexcept {}
+    void record_size(std::size_t) noexcept {}
+
+    ContainerStats snapshot() const noexcept { return {}; }
+    void reset() noexcept {}
+};
+
+// Counting policy; with Timed set, every scope also records its latency into
+// the operation's histogram.
+template <bool Timed>
+class BasicStats {
+private:
+    ContainerStats stats_;
+public:
+    static constexpr bool enabled = true;
+
+    class Scope {
+    private:
+        BasicStats* stats_;
+        Operation op_;
+        std::chrono::steady_clock::time_point start_;
+    public:
+        Scope(BasicStats* stats, Operation op) noexcept;
+        Scope(const Scope& other) = delete;
+
+        ~Scope() noexcept;
+
+        Scope& operator=(const Scope& other) = delete;
+    };
+
+    Scope scope(Operation op) noexcept;
+
+    void record_allocation(std::size_t count = 1) noexcept;
+    void record_free(std::size_t count = 1) noexcept;
+    void record_reallocation() noexcept;
+    void record_visits(Operation op, std::size_t nodes) noexcept;
+    void record_exception(Operation op) noexcept;
+    void record_size(std::size_t size) noexcept;
+
+    ContainerStats snapshot() const noexcept;
+    void reset() noexcept;
+};
+
+using CountingStats = BasicStats<false>;
+using LatencyStats = BasicStats<true>;
+
+#include "stats.inl"
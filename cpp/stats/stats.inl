@@ -0,0 +1,77 @@
+#include "stats.hpp"
+
+#include <algorithm>
+#include <bit>
+
+// ### ContainerStats ###
+
+inline const OperationStats& ContainerStats::operator[](Operation op) const noexcept {
+    return operations[static_cast<std::size_t>(op)];
+}
+
+// ### Scope ###
+
+template <bool Timed>
+BasicStats<Timed>::Scope::Scope(BasicStats* stats, Operation op) noexcept : stats_(stats), op_(op) {
+    stats_->stats_.operations[static_cast<std::size_t>(op_)].calls++;
+    if constexpr (Timed) start_ = std::chrono::steady_clock::now();
+}
+
+template <bool Timed>
+BasicStats<Timed>::Scope::~Scope() noexcept {
+    if constexpr (Timed) {
+        auto elapsed = std::chrono::steady_clock::now() - start_;
+        auto ns = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        std::size_t bucket = std::min<std::size_t>(std::bit_width(ns | 1) - 1, latencyBuckets - 1);
+        stats_->stats_.operations[static_cast<std::size_t>(op_)].latency[bucket]++;
+    }
+}
+
+// ### Hooks ###
+
+template <bool Timed>
+BasicStats<Timed>::Scope BasicStats<Timed>::scope(Operation op) noexcept {
+    return Scope(this, op);
+}
+
+template <bool Timed>
+void BasicStats<Timed>::record_allocation(std::size_t count) noexcept {
+    stats_.allocations += count;
+}
+
+template <bool Timed>
+void BasicStats<Timed>::record_free(std::size_t count) noexcept {
+    stats_.frees += count;
+}
+
+template <bool Timed>
+void BasicStats<Timed>::record_reallocation() noexcept {
+    stats_.reallocations++;
+}
+
+template <bool Timed>
+void BasicStats<Timed>::record_visits(Operation op, std::size_t nodes) noexcept {
+    stats_.operations[static_cast<std::size_t>(op)].nodesVisited += nodes;
+}
+
+template <bool Timed>
+void BasicStats<Timed>::record_exception(Operation op) noexcept {
+    stats_.operations[static_cast<std::size_t>(op)].exceptions++;
+}
+
+template <bool Timed>
+void BasicStats<Timed>::record_size(std::size_t size) noexcept {
+    stats_.peakSize = std::max<std::uint64_t>(stats_.peakSize, size);
+}
+
+// ### Snapshot ###
+
+template <bool Timed>
+ContainerStats BasicStats<Timed>::snapshot() const noexcept {
+    return stats_;
+}
+
+template <bool Timed>
+void BasicStats<Timed>::reset() noexcept {
+    stats_ = ContainerStats{};
+}
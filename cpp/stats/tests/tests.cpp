@@ -0,0 +1,85 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+
+#include "../stats.hpp"
+#include "list.hpp"
+#include "stack.hpp"
+
+TEST_CASE("no-op policy adds no state", "[nostats]") {
+    STATIC_REQUIRE(sizeof(Stack<int>) == sizeof(std::vector<int>));
+    STATIC_REQUIRE(sizeof(Stack<int, NoStats>) == sizeof(Stack<int>));
+
+    Stack<int> stack;
+    stack.push(1);
+    REQUIRE(stack.stats().operations[0].calls == 0);
+}
+
+TEST_CASE("stack counts pushes, reallocations and peak size", "[stack]") {
+    Stack<int, CountingStats> stack;
+    for (int i = 0; i < 100; ++i) stack.push(i);
+    for (int i = 0; i < 40; ++i) stack.pop();
+
+    ContainerStats stats = stack.stats();
+    REQUIRE(stats[Operation::push].calls == 100);
+    REQUIRE(stats[Operation::pop].calls == 40);
+    REQUIRE(stats.peakSize == 100);
+    REQUIRE(stats.reallocations > 0);
+    REQUIRE(stats.reallocations < 100);
+    REQUIRE(stats.allocations == stats.reallocations);
+    REQUIRE(stats.frees == stats.reallocations - 1);
+
+    stack.clear();
+    REQUIRE_THROWS_AS(stack.pop(), std::out_of_range);
+    REQUIRE_THROWS_AS(stack.top(), std::out_of_range);
+    stats = stack.stats();
+    REQUIRE(stats[Operation::pop].exceptions == 1);
+    REQUIRE(stats[Operation::access].exceptions == 1);
+
+    stack.reset_stats();
+    REQUIRE(stack.stats().peakSize == 0);
+}
+
+TEST_CASE("list counts allocations and nodes visited", "[list]") {
+    SinglyLinkedList<int, CountingStats> list;
+    for (int i = 0; i < 10; ++i) list.push_back(i);
+
+    REQUIRE(list.at(4) == 4);
+    REQUIRE(list.at(9) == 9);
+    REQUIRE(list.find(7) != nullptr);
+    REQUIRE(list.find(42) == nullptr);
+    REQUIRE_THROWS_AS(list.at(10), std::out_of_range);
+
+    ContainerStats stats = list.stats();
+    REQUIRE(stats.allocations == 10);
+    REQUIRE(stats.peakSize == 10);
+    REQUIRE(stats[Operation::at].calls == 3);
+    REQUIRE(stats[Operation::at].nodesVisited == 5 + 1);
+    REQUIRE(stats[Operation::at].exceptions == 1);
+    REQUIRE(stats[Operation::find].calls == 2);
+    REQUIRE(stats[Operation::find].nodesVisited == 8 + 10);
+
+    list.pop_back();
+    list.erase(3);
+    list.compact();
+    list.clear();
+
+    stats = list.stats();
+    REQUIRE(stats[Operation::pop].nodesVisited == 10);
+    REQUIRE(stats.allocations == 11);
+    REQUIRE(stats.frees == 11);
+}
+
+TEST_CASE("latency policy fills histograms", "[latency]") {
+    SinglyLinkedList<int, LatencyStats> list;
+    for (int i = 0; i < 1000; ++i) list.push_front(i);
+    list.sort();
+
+    ContainerStats stats = list.stats();
+    const auto& push = stats[Operation::push].latency;
+    REQUIRE(std::accumulate(push.begin(), push.end(), std::uint64_t{0}) == 1000);
+
+    const auto& sort = stats[Operation::sort].latency;
+    REQUIRE(std::accumulate(sort.begin(), sort.end(), std::uint64_t{0}) == 1);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Block codecs plug into the chunk stream as compile-time policies. A codec
+// provides an id recorded in the stream header, a worst-case output bound,
+// and block compress/decompress over raw bytes.
+
+struct NullCodec {
+    static constexpr std::uint8_t id = 0;
+
+    static std::size_t bound(std::size_t size) noexcept;
+    static std::size_t compress(const std::byte* src, std::size_t size, std::byte* dst);
+    static void decompress(const std::byte* src, std::size_t size, std::byte* dst, std::size_t rawSize);
+};
+
+// LZ4 block format (token, literals, 16-bit offset, match length) with a
+// greedy single-probe hash matcher.
+struct Lz4Codec {
+    static constexpr std::uint8_t id = 1;
+
+    static std::size_t bound(std::size_t size) noexcept;
+    static std::size_t compress(const std::byte* src, std::size_t size, std::byte* dst);
+    static void decompress(const std::byte* src, std::size_t size, std::byte* dst, std::size_t rawSize);
+};
+
+#include "codecs.inl"
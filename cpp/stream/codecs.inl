@@ -0,0 +1,168 @@
+#include "codecs.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+// ### NullCodec ###
+
+inline std::size_t NullCodec::bound(std::size_t size) noexcept { return size; }
+
+inline std::size_t NullCodec::compress(const std::byte* src, std::size_t size, std::byte* dst) {
+    std::memcpy(dst, src, size);
+    return size;
+}
+
+inline void NullCodec::decompress(const std::byte* src, std::size_t size, std::byte* dst, std::size_t rawSize) {
+    if (size != rawSize) throw std::runtime_error("corrupt block");
+    std::memcpy(dst, src, size);
+}
+
+// ### Lz4Codec ###
+
+namespace lz4_detail {
+
+inline constexpr int hashLog = 12;
+inline constexpr std::size_t minMatch = 4;
+inline constexpr std::size_t lastLiterals = 5;
+inline constexpr std::size_t matchFindLimit = 12;
+inline constexpr std::size_t maxOffset = 65535;
+
+inline std::uint32_t load32(const std::uint8_t* p) noexcept {
+    std::uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline std::uint32_t hash(std::uint32_t sequence) noexcept {
+    return (sequence * 2654435761u) >> (32 - hashLog);
+}
+
+inline std::uint8_t* writeLength(std::uint8_t* op, std::size_t length) noexcept {
+    while (length >= 255) {
+        *op++ = 255;
+        length -= 255;
+    }
+    *op++ = static_cast<std::uint8_t>(length);
+    return op;
+}
+
+inline std::uint8_t* writeLiterals(std::uint8_t* op, std::uint8_t* token, const std::uint8_t* literals, std::size_t length) noexcept {
+    if (length >= 15) {
+        *token = 15 << 4;
+        op = writeLength(op, length - 15);
+    } else {
+        *token = static_cast<std::uint8_t>(length << 4);
+    }
+    if (length > 0) std::memcpy(op, literals, length);
+    return op + length;
+}
+
+inline std::size_t readLength(const std::uint8_t* src, std::size_t size, std::size_t& ip) {
+    std::size_t length = 0;
+    std::uint8_t byte;
+    do {
+        if (ip >= size) throw std::runtime_error("corrupt lz4 block");
+        byte = src[ip++];
+        length += byte;
+    } while (byte == 255);
+    return length;
+}
+
+}
+
+inline std::size_t Lz4Codec::bound(std::size_t size) noexcept { return size + size / 255 + 16; }
+
+inline std::size_t Lz4Codec::compress(const std::byte* src, std::size_t size, std::byte* dst) {
+    using namespace lz4_detail;
+
+    const auto* in = reinterpret_cast<const std::uint8_t*>(src);
+    auto* out = reinterpret_cast<std::uint8_t*>(dst);
+    auto* op = out;
+
+    std::size_t anchor = 0;
+    if (size >= matchFindLimit) {
+        std::uint32_t table[1 << hashLog] = {};
+        std::size_t matchLimit = size - lastLiterals;
+
+        for (std::size_t ip = 0; ip + matchFindLimit <= size; ) {
+            std::uint32_t sequence = load32(in + ip);
+            std::uint32_t h = hash(sequence);
+            std::size_t ref = table[h];
+            table[h] = static_cast<std::uint32_t>(ip);
+
+            if (ref >= ip || ip - ref > maxOffset || load32(in + ref) != sequence) {
+                ip++;
+                continue;
+            }
+
+            std::size_t length = minMatch;
+            while (ip + length < matchLimit && in[ref + length] == in[ip + length]) length++;
+
+            std::uint8_t* token = op++;
+            op = writeLiterals(op, token, in + anchor, ip - anchor);
+
+            std::size_t offset = ip - ref;
+            *op++ = static_cast<std::uint8_t>(offset);
+            *op++ = static_cast<std::uint8_t>(offset >> 8);
+
+            std::size_t matchLength = length - minMatch;
+            if (matchLength >= 15) {
+                *token |= 15;
+                op = writeLength(op, matchLength - 15);
+            } else {
+                *token |= static_cast<std::uint8_t>(matchLength);
+            }
+
+            ip += length;
+            anchor = ip;
+        }
+    }
+
+    std::uint8_t* token = op++;
+    op = writeLiterals(op, token, in + anchor, size - anchor);
+
+    return static_cast<std::size_t>(op - out);
+}
+
+inline void Lz4Codec::decompress(const std::byte* src, std::size_t size, std::byte* dst, std::size_t rawSize) {
+    using namespace lz4_detail;
+
+    const auto* in = reinterpret_cast<const std::uint8_t*>(src);
+    auto* out = reinterpret_cast<std::uint8_t*>(dst);
+
+    std::size_t ip = 0;
+    std::size_t op = 0;
+    while (true) {
+        if (ip >= size) throw std::runtime_error("corrupt lz4 block");
+        std::uint8_t token = in[ip++];
+
+        std::size_t literals = token >> 4;
+        if (literals == 15) literals += readLength(in, size, ip);
+        if (literals > size - ip || literals > rawSize - op) throw std::runtime_error("corrupt lz4 block");
+
+        if (literals > 0) std::memcpy(out + op, in + ip, literals);
+        ip += literals;
+        op += literals;
+        if (ip == size) break;
+
+        if (size - ip < 2) throw std::runtime_error("corrupt lz4 block");
+        std::size_t offset = in[ip] | (static_cast<std::size_t>(in[ip + 1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > op) throw std::runtime_error("corrupt lz4 block");
+
+        std::size_t length = token & 15;
+        if (length == 15) length += readLength(in, size, ip);
+        length += minMatch;
+        if (length > rawSize - op) throw std::runtime_error("corrupt lz4 block");
+
+        const std::uint8_t* match = out + op - offset;
+        if (offset >= length) {
+            std::memcpy(out + op, match, length);
+        } else {
+            for (std::size_t i = 0; i < length; i++) out[op + i] = match[i];
+        }
+        op += length;
+    }
+
+    if (op != rawSize) throw std::runtime_error("corrupt lz4 block");
+}
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "codecs.hpp"
+#include "list.hpp"
+#include "stack.hpp"
+
+// Stream layout: a StreamHeader, then frames of {rawSize, storedSize, bytes}.
+// A frame whose storedSize equals rawSize is stored uncompressed; a frame with
+// rawSize 0 ends the stream. Elements are encoded back to back and may span
+// frame boundaries.
+struct StreamHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t chunkSize;
+    std::uint8_t codec;
+    std::uint8_t reserved[7];
+};
+
+struct FrameHeader {
+    std::uint32_t rawSize;
+    std::uint32_t storedSize;
+};
+
+inline constexpr char streamMagic[8] = {'D', 'S', 'A', 'S', 'T', 'R', 'M', '\0'};
+inline constexpr std::uint32_t streamVersion = 1;
+inline constexpr std::size_t maxStreamChunkSize = std::size_t(64) << 20;
+
+struct StreamOptions {
+    std::size_t chunkSize = std::size_t(1) << 16;
+    // Writing compresses chunk N+1 on one background thread while another
+    // writes chunk N and the caller encodes N+2; reading fetches and
+    // decompresses on a background thread while the caller decodes.
+    bool background = true;
+};
+
+template <typename S>
+concept ByteSink = requires(S& sink, const std::byte* data, std::size_t size) {
+    sink.write(data, size);
+};
+
+template <typename S>
+concept ByteSource = requires(S& source, std::byte* data, std::size_t size) {
+    { source.read(data, size) } -> std::convertible_to<std::size_t>;
+};
+
+// ### Sinks and sources ###
+
+class FdSink {
+private:
+    int fd_;
+public:
+    explicit FdSink(int fd) noexcept : fd_(fd) {}
+    void write(const std::byte* data, std::size_t size);
+};
+
+class FdSource {
+private:
+    int fd_;
+public:
+    explicit FdSource(int fd) noexcept : fd_(fd) {}
+    std::size_t read(std::byte* data, std::size_t size);
+};
+
+class BufferSink {
+private:
+    std::vector<std::byte>& buffer_;
+public:
+    explicit BufferSink(std::vector<std::byte>& buffer) noexcept : buffer_(buffer) {}
+    void write(const std::byte* data, std::size_t size);
+};
+
+class BufferSource {
+private:
+    std::span<const std::byte> buffer_;
+    std::size_t pos_ = 0;
+public:
+    explicit BufferSource(std::span<const std::byte> buffer) noexcept : buffer_(buffer) {}
+    std::size_t read(std::byte* data, std::size_t size);
+};
+
+// ### Chunk framing ###
+
+template <typename Codec, ByteSink Sink>
+class ChunkWriter {
+private:
+    Sink& sink_;
+    std::size_t chunkSize_;
+    bool background_;
+
+    std::vector<std::byte> current_;
+    std::vector<std::byte> pending_;
+    std::vector<std::byte> compressed_;
+    FrameHeader frameHeader_{};
+    std::vector<std::byte> frame_;
+
+    std::thread compressor_;
+    std::thread writer_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool hasPending_ = false;
+    bool hasFrame_ = false;
+    bool compressorDone_ = false;
+    bool stopping_ = false;
+    std::exception_ptr error_;
+
+    FrameHeader compressChunk(const std::vector<std::byte>& chunk);
+    void writeFrame(const FrameHeader& header, const std::vector<std::byte>& payload);
+    void flushChunk();
+    void compressLoop();
+    void writeLoop();
+    void stopWorker() noexcept;
+public:
+    ChunkWriter(Sink& sink, const StreamOptions& options);
+    ChunkWriter(const ChunkWriter& other) = delete;
+
+    ~ChunkWriter() noexcept;
+
+    ChunkWriter& operator=(const ChunkWriter& other) = delete;
+
+    void write(const void* data, std::size_t size);
+    void finish();
+};
+
+template <typename Codec, ByteSource Source>
+class ChunkReader {
+private:
+    Source& source_;
+    std::size_t chunkSize_ = 0;
+    bool background_;
+
+    std::vector<std::byte> current_;
+    std::size_t pos_ = 0;
+    bool ended_ = false;
+
+    std::vector<std::byte> ready_;
+    std::vector<std::byte> compressed_;
+    bool readyEnded_ = false;
+
+    std::thread worker_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool hasReady_ = false;
+    bool stopping_ = false;
+    std::exception_ptr error_;
+
+    void readExact(std::byte* data, std::size_t size);
+    bool readFrame(std::vector<std::byte>& chunk);
+    void refill();
+    void workerLoop();
+    void stopWorker() noexcept;
+public:
+    ChunkReader(Source& source, const StreamOptions& options);
+    ChunkReader(const ChunkReader& other) = delete;
+
+    ~ChunkReader() noexcept;
+
+    ChunkReader& operator=(const ChunkReader& other) = delete;
+
+    void read(void* data, std::size_t size);
+    bool atEnd();
+};
+
+// ### Element encoding ###
+
+// Specialize StreamElement<T> to stream other element types.
+template <typename T>
+struct StreamElement;
+
+template <typename T>
+    requires std::is_trivially_copyable_v<T>
+struct StreamElement<T> {
+    template <typename Writer>
+    static void write(Writer& writer, const T& value);
+
+    template <typename Reader>
+    static T read(Reader& reader);
+};
+
+template <>
+struct StreamElement<std::string> {
+    template <typename Writer>
+    static void write(Writer& writer, const std::string& value);
+
+    template <typename Reader>
+    static std::string read(Reader& reader);
+};
+
+// ### Container streaming ###
+
+template <typename Codec = NullCodec, typename T, typename Stats, ByteSink Sink>
+void serialize(const SinglyLinkedList<T, Stats>& list, Sink& sink, const StreamOptions& options = {});
+
+template <typename Codec = NullCodec, typename T, typename Stats, ByteSink Sink>
+void serialize(const Stack<T, Stats>& stack, Sink& sink, const StreamOptions& options = {});
+
+// Appends the streamed elements to the back of the list.
+template <typename Codec = NullCodec, typename T, typename Stats, ByteSource Source>
+void deserialize(Source& source, SinglyLinkedList<T, Stats>& list, const StreamOptions& options = {});
+
+// Pushes the streamed elements bottom to top.
+template <typename Codec = NullCodec, typename T, typename Stats, ByteSource Source>
+void deserialize(Source& source, Stack<T, Stats>& stack, const StreamOptions& options = {});
+
+#include "stream.inl"
@@ -0,0 +1,426 @@
+#include "stream.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <unistd.h>
+
+// ### Sinks and sources ###
+
+inline void FdSink::write(const std::byte* data, std::size_t size) {
+    while (size > 0) {
+        ssize_t written = ::write(fd_, data, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error("stream write failed");
+        }
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+}
+
+inline std::size_t FdSource::read(std::byte* data, std::size_t size) {
+    while (true) {
+        ssize_t received = ::read(fd_, data, size);
+        if (received >= 0) return static_cast<std::size_t>(received);
+        if (errno != EINTR) throw std::runtime_error("stream read failed");
+    }
+}
+
+inline void BufferSink::write(const std::byte* data, std::size_t size) {
+    buffer_.insert(buffer_.end(), data, data + size);
+}
+
+inline std::size_t BufferSource::read(std::byte* data, std::size_t size) {
+    std::size_t n = std::min(size, buffer_.size() - pos_);
+    std::memcpy(data, buffer_.data() + pos_, n);
+    pos_ += n;
+    return n;
+}
+
+// ### ChunkWriter ###
+
+template <typename Codec, ByteSink Sink>
+ChunkWriter<Codec, Sink>::ChunkWriter(Sink& sink, const StreamOptions& options)
+    : sink_(sink), chunkSize_(options.chunkSize), background_(options.background) {
+    if (chunkSize_ == 0 || chunkSize_ > maxStreamChunkSize) throw std::invalid_argument("invalid stream chunk size");
+
+    StreamHeader header{};
+    std::memcpy(header.magic, streamMagic, sizeof(header.magic));
+    header.version = streamVersion;
+    header.chunkSize = static_cast<std::uint32_t>(chunkSize_);
+    header.codec = Codec::id;
+    sink_.write(reinterpret_cast<const std::byte*>(&header), sizeof(header));
+
+    current_.reserve(chunkSize_);
+    if (background_) {
+        compressor_ = std::thread(&ChunkWriter::compressLoop, this);
+        try {
+            writer_ = std::thread(&ChunkWriter::writeLoop, this);
+        } catch (...) {
+            stopWorker();
+            throw;
+        }
+    }
+}
+
+template <typename Codec, ByteSink Sink>
+ChunkWriter<Codec, Sink>::~ChunkWriter() noexcept {
+    stopWorker();
+}
+
+template <typename Codec, ByteSink Sink>
+void ChunkWriter<Codec, Sink>::write(const void* data, std::size_t size) {
+    const auto* bytes = static_cast<const std::byte*>(data);
+    while (size > 0) {
+        std::size_t n = std::min(size, chunkSize_ - current_.size());
+        current_.insert(current_.end(), bytes, bytes + n);
+        bytes += n;
+        size -= n;
+
+        if (current_.size() == chunkSize_) flushChunk();
+    }
+}
+
+template <typename Codec, ByteSink Sink>
+void ChunkWriter<Codec, Sink>::finish() {
+    flushChunk();
+
+    if (background_) {
+        stopWorker();
+        if (error_) std::rethrow_exception(error_);
+    }
+
+    FrameHeader end{0, 0};
+    sink_.write(reinterpret_cast<const std::byte*>(&end), sizeof(end));
+}
+
+template <typename Codec, ByteSink Sink>
+FrameHeader ChunkWriter<Codec, Sink>::compressChunk(const std::vector<std::byte>& chunk) {
+    compressed_.resize(Codec::bound(chunk.size()));
+    std::size_t stored = Codec::compress(chunk.data(), chunk.size(), compressed_.data());
+
+    // A frame that does not shrink is stored raw, which the reader detects by storedSize == rawSize
+    bool raw = stored >= chunk.size();
+    return {static_cast<std::uint32_t>(chunk.size()), static_cast<std::uint32_t>(raw ? chunk.size() : stored)};
+}
+
+template <typename Codec, ByteSink Sink>
+void ChunkWriter<Codec, Sink>::writeFrame(const FrameHeader& header, const std::vector<std::byte>& payload) {
+    sink_.write(reinterpret_cast<const std::byte*>(&header), sizeof(header));
+    sink_.write(payload.data(), header.storedSize);
+}
+
+template <typename Codec, ByteSink Sink>
+void ChunkWriter<Codec, Sink>::flushChunk() {
+    if (current_.empty()) return;
+
+    if (!background_) {
+        FrameHeader header = compressChunk(current_);
+        writeFrame(header, header.storedSize == header.rawSize ? current_ : compressed_);
+        current_.clear();
+        return;
+    }
+
+    std::unique_lock lock(mutex_);
+    cv_.wait(lock, [this] { return !hasPending_ || error_; });
+    if (error_) std::rethrow_exception(error_);
+
+    current_.swap(pending_);
+    hasPending_ = true;
+    lock.unlock();
+    cv_.notify_all();
+
+    current_.clear();
+    current_.reserve(chunkSize_);
+}
+
+template <typename Codec, ByteSink Sink>
+void ChunkWriter<Codec, Sink>::compressLoop() {
+    while (true) {
+        std::unique_lock lock(mutex_);
+        cv_.wait(lock, [this] { return hasPending_ || stopping_ || error_; });
+        if (!hasPending_ || error_) {
+            compressorDone_ = true;
+            lock.unlock();
+            cv_.notify_all();
+            return;
+        }
+        lock.unlock();
+
+        FrameHeader header{};
+        std::exception_ptr error;
+        try {
+            header = compressChunk(pending_);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        // Hands the frame over by swapping buffers, so nothing is copied
+        lock.lock();
+        cv_.wait(lock, [this] { return !hasFrame_ || error_; });
+        if (error) error_ = error;
+        if (!error_) {
+            frameHeader_ = header;
+            frame_.swap(header.storedSize == header.rawSize ? pending_ : compressed_);
+            hasFrame_ = true;
+        }
+        pending_.clear();
+        hasPending_ = false;
+        lock.unlock();
+        cv_.notify_all();
+    }
+}
+
+template <typename Codec, ByteSink Sink>
+void ChunkWriter<Codec, Sink>::writeLoop() {
+    while (true) {
+        std::unique_lock lock(mutex_);
+        cv_.wait(lock, [this] { return hasFrame_ || compressorDone_; });
+        if (!hasFrame_) return;
+        lock.unlock();
+
+        std::exception_ptr error;
+        try {
+            writeFrame(frameHeader_, frame_);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        hasFrame_ = false;
+        if (error) error_ = error;
+        lock.unlock();
+        cv_.notify_all();
+
+        if (error) return;
+    }
+}
+
+template <typename Codec, ByteSink Sink>
+void ChunkWriter<Codec, Sink>::stopWorker() noexcept {
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    if (compressor_.joinable()) compressor_.join();
+    if (writer_.joinable()) writer_.join();
+}
+
+// ### ChunkReader ###
+
+template <typename Codec, ByteSource Source>
+ChunkReader<Codec, Source>::ChunkReader(Source& source, const StreamOptions& options)
+    : source_(source), background_(options.background) {
+    StreamHeader header;
+    readExact(reinterpret_cast<std::byte*>(&header), sizeof(header));
+
+    if (std::memcmp(header.magic, streamMagic, sizeof(header.magic)) != 0) throw std::runtime_error("not a container stream");
+    if (header.version != streamVersion) throw std::runtime_error("unsupported stream version");
+    if (header.codec != Codec::id && header.codec != NullCodec::id) throw std::runtime_error("stream codec mismatch");
+    if (header.chunkSize == 0 || header.chunkSize > maxStreamChunkSize) throw std::runtime_error("corrupt stream header");
+
+    chunkSize_ = header.chunkSize;
+    if (background_) worker_ = std::thread(&ChunkReader::workerLoop, this);
+}
+
+template <typename Codec, ByteSource Source>
+ChunkReader<Codec, Source>::~ChunkReader() noexcept {
+    stopWorker();
+}
+
+template <typename Codec, ByteSource Source>
+void ChunkReader<Codec, Source>::read(void* data, std::size_t size) {
+    auto* bytes = static_cast<std::byte*>(data);
+    while (size > 0) {
+        if (pos_ == current_.size()) {
+            if (ended_) throw std::runtime_error("truncated stream");
+            refill();
+            continue;
+        }
+
+        std::size_t n = std::min(size, current_.size() - pos_);
+        std::memcpy(bytes, current_.data() + pos_, n);
+        pos_ += n;
+        bytes += n;
+        size -= n;
+    }
+}
+
+template <typename Codec, ByteSource Source>
+bool ChunkReader<Codec, Source>::atEnd() {
+    while (pos_ == current_.size() && !ended_) refill();
+    return pos_ == current_.size();
+}
+
+template <typename Codec, ByteSource Source>
+void ChunkReader<Codec, Source>::readExact(std::byte* data, std::size_t size) {
+    while (size > 0) {
+        std::size_t n = source_.read(data, size);
+        if (n == 0) throw std::runtime_error("truncated stream");
+        data += n;
+        size -= n;
+    }
+}
+
+template <typename Codec, ByteSource Source>
+bool ChunkReader<Codec, Source>::readFrame(std::vector<std::byte>& chunk) {
+    FrameHeader header;
+    readExact(reinterpret_cast<std::byte*>(&header), sizeof(header));
+
+    chunk.clear();
+    if (header.rawSize == 0) return false;
+    if (header.rawSize > chunkSize_ || header.storedSize > Codec::bound(header.rawSize)) {
+        throw std::runtime_error("corrupt stream frame");
+    }
+
+    chunk.resize(header.rawSize);
+    if (header.storedSize == header.rawSize) {
+        readExact(chunk.data(), chunk.size());
+    } else {
+        compressed_.resize(header.storedSize);
+        readExact(compressed_.data(), compressed_.size());
+        Codec::decompress(compressed_.data(), compressed_.size(), chunk.data(), chunk.size());
+    }
+    return true;
+}
+
+template <typename Codec, ByteSource Source>
+void ChunkReader<Codec, Source>::refill() {
+    pos_ = 0;
+
+    if (!background_) {
+        ended_ = !readFrame(current_);
+        return;
+    }
+
+    std::unique_lock lock(mutex_);
+    cv_.wait(lock, [this] { return hasReady_; });
+    if (error_) std::rethrow_exception(error_);
+
+    current_.swap(ready_);
+    ended_ = readyEnded_;
+    hasReady_ = false;
+    lock.unlock();
+    cv_.notify_all();
+}
+
+template <typename Codec, ByteSource Source>
+void ChunkReader<Codec, Source>::workerLoop() {
+    while (true) {
+        std::unique_lock lock(mutex_);
+        cv_.wait(lock, [this] { return !hasReady_ || stopping_; });
+        if (stopping_) return;
+        lock.unlock();
+
+        bool more = false;
+        std::exception_ptr error;
+        try {
+            more = readFrame(ready_);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        readyEnded_ = !more;
+        error_ = error;
+        hasReady_ = true;
+        lock.unlock();
+        cv_.notify_all();
+
+        if (!more) return;
+    }
+}
+
+template <typename Codec, ByteSource Source>
+void ChunkReader<Codec, Source>::stopWorker() noexcept {
+    if (!worker_.joinable()) return;
+
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    worker_.join();
+}
+
+// ### Element encoding ###
+
+template <typename T>
+    requires std::is_trivially_copyable_v<T>
+template <typename Writer>
+void StreamElement<T>::write(Writer& writer, const T& value) {
+    writer.write(&value, sizeof(T));
+}
+
+template <typename T>
+    requires std::is_trivially_copyable_v<T>
+template <typename Reader>
+T StreamElement<T>::read(Reader& reader) {
+    std::array<std::byte, sizeof(T)> bytes;
+    reader.read(bytes.data(), bytes.size());
+    return std::bit_cast<T>(bytes);
+}
+
+template <typename Writer>
+void StreamElement<std::string>::write(Writer& writer, const std::string& value) {
+    std::uint64_t length = value.size();
+    writer.write(&length, sizeof(length));
+    writer.write(value.data(), value.size());
+}
+
+template <typename Reader>
+std::string StreamElement<std::string>::read(Reader& reader) {
+    std::uint64_t length;
+    reader.read(&length, sizeof(length));
+
+    // Grows only as bytes arrive, so a corrupt length ends as a truncated
+    // stream rather than one huge allocation
+    constexpr std::size_t piece = std::size_t(1) << 16;
+    std::string value;
+    if (length > value.max_size()) throw std::runtime_error("corrupt stream string");
+    while (value.size() < length) {
+        std::size_t offset = value.size();
+        std::size_t n = static_cast<std::size_t>(std::min<std::uint64_t>(length - offset, piece));
+        value.resize(offset + n);
+        reader.read(value.data() + offset, n);
+    }
+    return value;
+}
+
+// ### Container streaming ###
+
+template <typename Codec, typename T, typename Stats, ByteSink Sink>
+void serialize(const SinglyLinkedList<T, Stats>& list, Sink& sink, const StreamOptions& options) {
+    ChunkWriter<Codec, Sink> writer(sink, options);
+    for (auto it = list.cbegin(); it != list.cend(); ++it) StreamElement<T>::write(writer, *it);
+    writer.finish();
+}
+
+template <typename Codec, typename T, typename Stats, ByteSink Sink>
+void serialize(const Stack<T, Stats>& stack, Sink& sink, const StreamOptions& options) {
+    ChunkWriter<Codec, Sink> writer(sink, options);
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        writer.write(stack.data(), stack.size() * sizeof(T));
+    } else {
+        for (std::size_t i = 0; i < stack.size(); i++) StreamElement<T>::write(writer, stack.data()[i]);
+    }
+    writer.finish();
+}
+
+template <typename Codec, typename T, typename Stats, ByteSource Source>
+void deserialize(Source& source, SinglyLinkedList<T, Stats>& list, const StreamOptions& options) {
+    ChunkReader<Codec, Source> reader(source, options);
+    while (!reader.atEnd()) list.push_back(StreamElement<T>::read(reader));
+}
+
+template <typename Codec, typename T, typename Stats, ByteSource Source>
+void deserialize(Source& source, Stack<T, Stats>& stack, const StreamOptions& options) {
+    ChunkReader<Codec, Source> reader(source, options);
+    while (!reader.atEnd()) stack.push(StreamElement<T>::read(reader));
+}
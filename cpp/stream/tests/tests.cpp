@@ -0,0 +1,162 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "../stream.hpp"
+
+static std::vector<std::byte> compressible(std::size_t size) {
+    std::vector<std::byte> data(size);
+    for (std::size_t i = 0; i < size; ++i) data[i] = static_cast<std::byte>((i / 7) % 13);
+    return data;
+}
+
+TEST_CASE("lz4 codec round trip", "[codec]") {
+    std::mt19937 rng(7);
+    std::vector<std::byte> random(5000);
+    for (auto& b : random) b = static_cast<std::byte>(rng());
+
+    for (const auto& input : {compressible(100000), random, compressible(11), std::vector<std::byte>{}}) {
+        std::vector<std::byte> compressed(Lz4Codec::bound(input.size()));
+        std::size_t stored = Lz4Codec::compress(input.data(), input.size(), compressed.data());
+        REQUIRE(stored <= compressed.size());
+
+        std::vector<std::byte> output(input.size());
+        Lz4Codec::decompress(compressed.data(), stored, output.data(), output.size());
+        REQUIRE(output == input);
+    }
+
+    auto input = compressible(100000);
+    std::vector<std::byte> compressed(Lz4Codec::bound(input.size()));
+    std::size_t stored = Lz4Codec::compress(input.data(), input.size(), compressed.data());
+    REQUIRE(stored < input.size() / 10);
+
+    std::vector<std::byte> output(input.size());
+    REQUIRE_THROWS_AS(Lz4Codec::decompress(compressed.data(), stored / 2, output.data(), output.size()), std::runtime_error);
+}
+
+TEST_CASE("list streams through a buffer", "[list]") {
+    SinglyLinkedList<std::int64_t> list;
+    for (std::int64_t i = 0; i < 50000; ++i) list.push_back(i % 100);
+
+    for (bool background : {false, true}) {
+        StreamOptions options;
+        options.chunkSize = 4096;
+        options.background = background;
+
+        std::vector<std::byte> bytes;
+        BufferSink sink(bytes);
+        serialize<Lz4Codec>(list, sink, options);
+        REQUIRE(bytes.size() < list.size() * sizeof(std::int64_t) / 4);
+
+        BufferSource source(bytes);
+        SinglyLinkedList<std::int64_t> copy;
+        deserialize<Lz4Codec>(source, copy, options);
+
+        REQUIRE(copy.size() == list.size());
+        auto it = list.cbegin();
+        for (auto jt = copy.cbegin(); jt != copy.cend(); ++jt, ++it) REQUIRE(*jt == *it);
+    }
+}
+
+TEST_CASE("strings span chunk boundaries", "[strings]") {
+    Stack<std::string> stack;
+    for (int i = 0; i < 300; ++i) stack.push(std::string(i, static_cast<char>('a' + i % 26)));
+
+    StreamOptions options;
+    options.chunkSize = 64;
+
+    std::vector<std::byte> bytes;
+    BufferSink sink(bytes);
+    serialize(stack, sink, options);
+
+    BufferSource source(bytes);
+    Stack<std::string> copy;
+    deserialize(source, copy, options);
+
+    REQUIRE(copy == stack);
+}
+
+TEST_CASE("stack streams through a pipe", "[stack][pipe]") {
+    Stack<std::uint32_t> stack;
+    for (std::uint32_t i = 0; i < 200000; ++i) stack.push(i);
+
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+
+    std::thread producer([&] {
+        FdSink sink(fds[1]);
+        serialize<Lz4Codec>(stack, sink);
+        ::close(fds[1]);
+    });
+
+    FdSource source(fds[0]);
+    Stack<std::uint32_t> copy;
+    deserialize<Lz4Codec>(source, copy);
+    producer.join();
+    ::close(fds[0]);
+
+    REQUIRE(copy == stack);
+}
+
+TEST_CASE("malformed streams are rejected", "[errors]") {
+    SinglyLinkedList<int> list;
+    for (int i = 0; i < 1000; ++i) list.push_back(i);
+
+    std::vector<std::byte> bytes;
+    BufferSink sink(bytes);
+    serialize<Lz4Codec>(list, sink);
+
+    SinglyLinkedList<int> copy;
+
+    std::vector<std::byte> truncated(bytes.begin(), bytes.end() - 12);
+    BufferSource truncatedSource(truncated);
+    REQUIRE_THROWS_AS(deserialize<Lz4Codec>(truncatedSource, copy), std::runtime_error);
+
+    BufferSource mismatchSource(bytes);
+    REQUIRE_THROWS_AS(deserialize<NullCodec>(mismatchSource, copy), std::runtime_error);
+
+    std::vector<std::byte> garbage(64, std::byte{0x5a});
+    BufferSource garbageSource(garbage);
+    REQUIRE_THROWS_AS(deserialize(garbageSource, copy), std::runtime_error);
+}
+
+TEST_CASE("sink errors surface from the background writer", "[errors]") {
+    struct FailingSink {
+        std::size_t writes = 0;
+        void write(const std::byte*, std::size_t) {
+            if (++writes > 5) throw std::runtime_error("sink full");
+        }
+    };
+
+    Stack<std::int64_t> stack;
+    for (std::int64_t i = 0; i < 100000; ++i) stack.push(i);
+
+    StreamOptions options;
+    options.chunkSize = 1024;
+    FailingSink sink;
+    REQUIRE_THROWS_AS(serialize<Lz4Codec>(stack, sink, options), std::runtime_error);
+    REQUIRE(sink.writes == 6);
+}
+
+TEST_CASE("corrupt string lengths are rejected", "[strings][errors]") {
+    Stack<std::string> stack;
+    stack.push("abc");
+
+    std::vector<std::byte> bytes;
+    BufferSink sink(bytes);
+    serialize(stack, sink);
+
+    std::uint64_t length = std::uint64_t(1) << 40;
+    std::memcpy(bytes.data() + sizeof(StreamHeader) + sizeof(FrameHeader), &length, sizeof(length));
+
+    BufferSource source(bytes);
+    Stack<std::string> copy;
+    REQUIRE_THROWS_AS(deserialize(source, copy), std::runtime_error);
+}